@@ -1,51 +1,252 @@
 #include "Archive.h"
+#include <algorithm>
 
-Archive::Archive(std::span<const uint8_t> queue) noexcept {
-	for(uint8_t value : queue) {
-		pushDataPoint(value);
+Archive::Archive(std::span<const uint8_t> queue) noexcept : byteBuffer(queue.begin(), queue.end()) {}
+
+Archive::Archive(const std::queue<uint8_t>& queue) noexcept : Archive(std::queue<uint8_t>(queue)) {}
+
+Archive::Archive(std::queue<uint8_t>&& queue) noexcept {
+	byteBuffer.reserve(queue.size());
+
+	while(!queue.empty()){
+		byteBuffer.emplace_back(queue.front());
+		queue.pop();
 	}
 }
 
-Archive::Archive(const std::queue<uint8_t>& queue) noexcept : byteBuffer(queue) {}
-
-Archive::Archive(std::queue<uint8_t>&& queue) noexcept : byteBuffer(std::move(queue)) {}
+Archive::Archive(std::vector<uint8_t>&& buffer) noexcept : byteBuffer(std::move(buffer)) {}
 
 void Archive::toByteArray(std::vector<uint8_t>& buffer) const noexcept {
-	buffer.clear();
+	buffer.assign(readData() + readCursor, readData() + dataSize());
+}
 
-	if(buffer.capacity() < byteBuffer.size()) {
-		buffer.reserve(byteBuffer.size());
+void Archive::takeByteArray(std::vector<uint8_t>& buffer) noexcept {
+	if(borrowing){
+		detach();
 	}
 
-	std::queue<uint8_t> bufferCopy = byteBuffer;
-
-	while(!bufferCopy.empty()){
-		buffer.emplace_back(bufferCopy.front());
-		bufferCopy.pop();
+	if(readCursor > 0){
+		byteBuffer.erase(byteBuffer.begin(), byteBuffer.begin() + readCursor);
+		readCursor = 0;
 	}
+
+	buffer = std::move(byteBuffer);
+	byteBuffer.clear();
 }
 
 void Archive::pushDataPoint(uint8_t data) noexcept {
-	byteBuffer.push(data);
+	pushBytes(&data, 1);
 }
 
 bool Archive::popDataPoint(uint8_t& data) noexcept {
-	if(byteBuffer.empty()){
+	return popBytes(&data, 1);
+}
+
+void Archive::pushBytes(const uint8_t* data, size_t count) noexcept {
+	if(data == nullptr || count == 0){
+		return;
+	}
+
+	if(borrowing){
+		detach();
+	}
+
+	// Once everything was read out, reuse the buffer from the start instead of growing it further
+	if(readCursor > 0 && readCursor == byteBuffer.size()){
+		byteBuffer.clear();
+		readCursor = 0;
+	}
+
+	byteBuffer.insert(byteBuffer.end(), data, data + count);
+}
+
+bool Archive::popBytes(uint8_t* data, size_t count) noexcept {
+	if(count > size()){
 		return false;
 	}
 
-	const uint8_t value = byteBuffer.front();
-	data = value;
-	byteBuffer.pop();
+	memcpy(data, readData() + readCursor, count);
+	readCursor += count;
 
 	return true;
 }
 
+const uint8_t* Archive::viewBytes(size_t count) noexcept {
+	if(count > size()){
+		return nullptr;
+	}
+
+	const uint8_t* data = readData() + readCursor;
+	readCursor += count;
+
+	return data;
+}
+
+void Archive::seekTo(size_t cursor) noexcept {
+	readCursor = std::min(cursor, dataSize());
+}
+
+void Archive::patchBytes(size_t position, const uint8_t* data, size_t count) noexcept {
+	if(data == nullptr || position + count > size()){
+		return;
+	}
+
+	if(borrowing){
+		detach();
+	}
+
+	memcpy(byteBuffer.data() + readCursor + position, data, count);
+}
+
+void Archive::encodeSectionLength(uint32_t length, uint8_t* bytes) noexcept {
+	for(size_t i = 0; i < sizeof(uint32_t); ++i){
+		bytes[i] = (length >> (i * 8)) & 0xFF;
+	}
+}
+
+uint32_t Archive::decodeSectionLength(const uint8_t* bytes) noexcept {
+	uint32_t length = 0;
+
+	for(size_t i = 0; i < sizeof(uint32_t); ++i){
+		length |= (uint32_t) bytes[i] << (i * 8);
+	}
+
+	return length;
+}
+
+void Archive::reserveBytes(size_t count) noexcept {
+	if(borrowing){
+		detach();
+	}
+
+	byteBuffer.reserve(byteBuffer.size() + count);
+}
+
+void Archive::borrow(std::span<const uint8_t> data) noexcept {
+	byteBuffer.clear();
+	byteBuffer.shrink_to_fit();
+	borrowedData = data;
+	readCursor = 0;
+	borrowing = true;
+}
+
+void Archive::detach() noexcept {
+	byteBuffer.assign(borrowedData.begin() + readCursor, borrowedData.end());
+	borrowedData = {};
+	readCursor = 0;
+	borrowing = false;
+}
+
+void Archive::pushLength(size_t length) noexcept {
+	pushData<size_t>(length);
+}
+
+bool Archive::popLength(size_t& length, size_t elementSize) noexcept {
+	length = 0;
+
+	size_t value = 0;
+	if(!popData<size_t>(value)){
+		return false;
+	}
+
+	// Compact elements can be as small as a single byte
+	if(encoding == Encoding::Compact){
+		elementSize = std::min<size_t>(elementSize, 1);
+	}
+
+	if(elementSize > 0 && value > size() / elementSize){
+		return false;
+	}
+
+	length = value;
+
+	return true;
+}
+
+void Archive::pushVarint(uint64_t value) noexcept {
+	uint8_t bytes[10];
+	size_t count = 0;
+
+	do{
+		bytes[count] = value & 0x7F;
+		value >>= 7;
+
+		if(value != 0){
+			bytes[count] |= 0x80;
+		}
+
+		++count;
+	}while(value != 0);
+
+	pushBytes(bytes, count);
+}
+
+bool Archive::popVarint(uint64_t& value, size_t width) noexcept {
+	const size_t cursor = tell();
+	value = 0;
+
+	for(size_t shift = 0; shift < 64; shift += 7){
+		uint8_t byte = 0;
+		if(!popBytes(&byte, 1)){
+			break;
+		}
+
+		// The tenth byte may only carry the single remaining bit of a 64-bit value
+		if(shift == 63 && (byte & 0x7E) != 0){
+			break;
+		}
+
+		value |= (uint64_t) (byte & 0x7F) << shift;
+
+		if((byte & 0x80) == 0){
+			if(width < sizeof(uint64_t) && (value >> (width * 8)) != 0){
+				break;
+			}
+
+			return true;
+		}
+	}
+
+	seekTo(cursor);
+	value = 0;
+
+	return false;
+}
+
 InArchive::InArchive(std::span<const uint8_t> queue) noexcept : Archive(queue) {}
 
 InArchive::InArchive(const std::queue<uint8_t>& queue) noexcept : Archive(queue) {}
 
-InArchive::InArchive(std::queue<uint8_t>&& queue) noexcept : Archive(queue) {}
+InArchive::InArchive(std::queue<uint8_t>&& queue) noexcept : Archive(std::move(queue)) {}
+
+InArchive::InArchive(std::vector<uint8_t>&& buffer) noexcept : Archive(std::move(buffer)) {}
+
+void InArchive::reserve(size_t size) noexcept {
+	reserveBytes(size);
+}
+
+void InArchive::beginSection(uint32_t id) noexcept {
+	pushData<uint32_t>(id);
+
+	// Length placeholder, filled in by endSection()
+	uint8_t length[sizeof(uint32_t)] = { 0 };
+	pushBytes(length, sizeof(length));
+
+	sectionStarts.push_back(size());
+}
+
+void InArchive::endSection() noexcept {
+	if(sectionStarts.empty()){
+		return;
+	}
+
+	const size_t start = sectionStarts.back();
+	sectionStarts.pop_back();
+
+	uint8_t length[sizeof(uint32_t)];
+	encodeSectionLength(size() - start, length);
+	patchBytes(start - sizeof(length), length, sizeof(length));
+}
 
 Archive& InArchive::operator << (bool& data) noexcept {
 	pushData<bool>(data);
@@ -112,27 +313,21 @@ Archive& InArchive::operator << (long double& data) noexcept {
 	return *this;
 }
 Archive& InArchive::operator << (std::string& data) noexcept {
-	pushData<size_t>(data.size());
-
-	for(size_t i = 0; i < data.size(); ++i){
-		pushData<char>(data[i]);
-	}
+	pushLength(data.size());
+	pushData<char>(data.data(), data.size());
 
 	return *this;
 }
 
 Archive& InArchive::operator<<(std::wstring& data) noexcept {
-	pushData<size_t>(data.size());
-
-	for(size_t i = 0; i < data.size(); ++i){
-		pushData<wchar_t>(data[i]);
-	}
+	pushLength(data.size());
+	pushData<wchar_t>(data.data(), data.size());
 
 	return *this;
 }
 
 Archive& InArchive::operator << (std::vector<bool>& data) noexcept {
-	pushData<size_t>(data.size());
+	pushLength(data.size());
 
 	for(size_t i = 0; i < data.size(); ++i){
 		pushData<bool>(data[i]);
@@ -142,127 +337,91 @@ Archive& InArchive::operator << (std::vector<bool>& data) noexcept {
 }
 
 Archive& InArchive::operator << (std::vector<wchar_t>& data) noexcept {
-	pushData<size_t>(data.size());
-
-	for(size_t i = 0; i < data.size(); ++i){
-		pushData<wchar_t>(data[i]);
-	}
+	pushLength(data.size());
+	pushData<wchar_t>(data.data(), data.size());
 
 	return *this;
 }
 
 Archive& InArchive::operator << (std::vector<uint8_t>& data) noexcept {
-	pushData<size_t>(data.size());
-
-	for(size_t i = 0; i < data.size(); ++i){
-		pushData<uint8_t>(data[i]);
-	}
+	pushLength(data.size());
+	pushData<uint8_t>(data.data(), data.size());
 
 	return *this;
 }
 
 Archive& InArchive::operator << (std::vector<uint16_t>& data) noexcept {
-	pushData<size_t>(data.size());
-
-	for(size_t i = 0; i < data.size(); ++i){
-		pushData<uint16_t>(data[i]);
-	}
+	pushLength(data.size());
+	pushData<uint16_t>(data.data(), data.size());
 
 	return *this;
 }
 
 Archive& InArchive::operator << (std::vector<uint32_t>& data) noexcept {
-	pushData<size_t>(data.size());
-
-	for(size_t i = 0; i < data.size(); ++i){
-		pushData<uint32_t>(data[i]);
-	}
+	pushLength(data.size());
+	pushData<uint32_t>(data.data(), data.size());
 
 	return *this;
 }
 
 Archive& InArchive::operator << (std::vector<uint64_t>& data) noexcept {
-	pushData<size_t>(data.size());
-
-	for(size_t i = 0; i < data.size(); ++i){
-		pushData<uint64_t>(data[i]);
-	}
+	pushLength(data.size());
+	pushData<uint64_t>(data.data(), data.size());
 
 	return *this;
 }
 
 Archive& InArchive::operator << (std::vector<int8_t>& data) noexcept {
-	pushData<size_t>(data.size());
-
-	for(size_t i = 0; i < data.size(); ++i){
-		pushData<int8_t>(data[i]);
-	}
+	pushLength(data.size());
+	pushData<int8_t>(data.data(), data.size());
 
 	return *this;
 }
 
 Archive& InArchive::operator << (std::vector<int16_t>& data) noexcept {
-	pushData<size_t>(data.size());
-
-	for(size_t i = 0; i < data.size(); ++i){
-		pushData<int16_t>(data[i]);
-	}
+	pushLength(data.size());
+	pushData<int16_t>(data.data(), data.size());
 
 	return *this;
 }
 
 Archive& InArchive::operator << (std::vector<int32_t>& data) noexcept {
-	pushData<size_t>(data.size());
-
-	for(size_t i = 0; i < data.size(); ++i){
-		pushData<int32_t>(data[i]);
-	}
+	pushLength(data.size());
+	pushData<int32_t>(data.data(), data.size());
 
 	return *this;
 }
 
 Archive& InArchive::operator << (std::vector<int64_t>& data) noexcept {
-	pushData<size_t>(data.size());
-
-	for(size_t i = 0; i < data.size(); ++i){
-		pushData<int64_t>(data[i]);
-	}
+	pushLength(data.size());
+	pushData<int64_t>(data.data(), data.size());
 
 	return *this;
 }
 
 Archive& InArchive::operator << (std::vector<float>& data) noexcept {
-	pushData<size_t>(data.size());
-
-	for(size_t i = 0; i < data.size(); ++i){
-		pushData<float>(data[i]);
-	}
+	pushLength(data.size());
+	pushData<float>(data.data(), data.size());
 
 	return *this;
 }
 
 Archive& InArchive::operator << (std::vector<double>& data) noexcept {
-	pushData<size_t>(data.size());
-
-	for(size_t i = 0; i < data.size(); ++i){
-		pushData<double>(data[i]);
-	}
+	pushLength(data.size());
+	pushData<double>(data.data(), data.size());
 
 	return *this;
 }
 
 Archive& InArchive::operator << (std::vector<long double>& data) noexcept {
-	pushData<size_t>(data.size());
-
-	for(size_t i = 0; i < data.size(); ++i){
-		pushData<long double>(data[i]);
-	}
+	pushLength(data.size());
+	pushData<long double>(data.data(), data.size());
 
 	return *this;
 }
 
 Archive& InArchive::operator << (std::vector<std::string>& data) noexcept {
-	pushData<size_t>(data.size());
+	pushLength(data.size());
 
 	for(size_t i = 0; i < data.size(); ++i){
 		operator<<(data[i]);
@@ -272,7 +431,7 @@ Archive& InArchive::operator << (std::vector<std::string>& data) noexcept {
 }
 
 Archive& InArchive::operator<<(std::vector<std::wstring>& data) noexcept {
-	pushData<size_t>(data.size());
+	pushLength(data.size());
 
 	for(size_t i = 0; i < data.size(); ++i){
 		operator<<(data[i]);
@@ -281,6 +440,18 @@ Archive& InArchive::operator<<(std::vector<std::wstring>& data) noexcept {
 	return *this;
 }
 
+Archive& InArchive::operator << (std::string_view& data) noexcept {
+	pushLength(data.size());
+	pushData<char>(data.data(), data.size());
+	return *this;
+}
+
+Archive& InArchive::operator << (std::span<const uint8_t>& data) noexcept {
+	pushLength(data.size());
+	pushData<uint8_t>(data.data(), data.size());
+	return *this;
+}
+
 Archive& InArchive::operator << (bool data) noexcept {
 	pushData<bool>(data);
 	return *this;
@@ -347,27 +518,21 @@ Archive& InArchive::operator << (long double data) noexcept {
 }
 
 Archive& InArchive::operator << (const std::string& data) noexcept {
-	pushData<size_t>(data.size());
-
-	for(size_t i = 0; i < data.size(); ++i){
-		pushData<char>(data[i]);
-	}
+	pushLength(data.size());
+	pushData<char>(data.data(), data.size());
 
 	return *this;
 }
 
 Archive& InArchive::operator << (const std::wstring& data) noexcept {
-	pushData<size_t>(data.size());
-
-	for(size_t i = 0; i < data.size(); ++i){
-		pushData<wchar_t>(data[i]);
-	}
+	pushLength(data.size());
+	pushData<wchar_t>(data.data(), data.size());
 
 	return *this;
 }
 
 Archive& InArchive::operator << (const std::vector<bool>& data) noexcept {
-	pushData<size_t>(data.size());
+	pushLength(data.size());
 
 	for(size_t i = 0; i < data.size(); ++i){
 		pushData<bool>(data[i]);
@@ -377,127 +542,91 @@ Archive& InArchive::operator << (const std::vector<bool>& data) noexcept {
 }
 
 Archive& InArchive::operator << (const std::vector<wchar_t>& data) noexcept {
-	pushData<size_t>(data.size());
-
-	for(size_t i = 0; i < data.size(); ++i){
-		pushData<wchar_t>(data[i]);
-	}
+	pushLength(data.size());
+	pushData<wchar_t>(data.data(), data.size());
 
 	return *this;
 }
 
 Archive& InArchive::operator << (const std::vector<uint8_t>& data) noexcept {
-	pushData<size_t>(data.size());
-
-	for(size_t i = 0; i < data.size(); ++i){
-		pushData<uint8_t>(data[i]);
-	}
+	pushLength(data.size());
+	pushData<uint8_t>(data.data(), data.size());
 
 	return *this;
 }
 
 Archive& InArchive::operator << (const std::vector<uint16_t>& data) noexcept {
-	pushData<size_t>(data.size());
-
-	for(size_t i = 0; i < data.size(); ++i){
-		pushData<uint16_t>(data[i]);
-	}
+	pushLength(data.size());
+	pushData<uint16_t>(data.data(), data.size());
 
 	return *this;
 }
 
 Archive& InArchive::operator << (const std::vector<uint32_t>& data) noexcept {
-	pushData<size_t>(data.size());
-
-	for(size_t i = 0; i < data.size(); ++i){
-		pushData<uint32_t>(data[i]);
-	}
+	pushLength(data.size());
+	pushData<uint32_t>(data.data(), data.size());
 
 	return *this;
 }
 
 Archive& InArchive::operator << (const std::vector<uint64_t>& data) noexcept {
-	pushData<size_t>(data.size());
-
-	for(size_t i = 0; i < data.size(); ++i){
-		pushData<uint64_t>(data[i]);
-	}
+	pushLength(data.size());
+	pushData<uint64_t>(data.data(), data.size());
 
 	return *this;
 }
 
 Archive& InArchive::operator << (const std::vector<int8_t>& data) noexcept {
-	pushData<size_t>(data.size());
-
-	for(size_t i = 0; i < data.size(); ++i){
-		pushData<int8_t>(data[i]);
-	}
+	pushLength(data.size());
+	pushData<int8_t>(data.data(), data.size());
 
 	return *this;
 }
 
 Archive& InArchive::operator << (const std::vector<int16_t>& data) noexcept {
-	pushData<size_t>(data.size());
-
-	for(size_t i = 0; i < data.size(); ++i){
-		pushData<int16_t>(data[i]);
-	}
+	pushLength(data.size());
+	pushData<int16_t>(data.data(), data.size());
 
 	return *this;
 }
 
 Archive& InArchive::operator << (const std::vector<int32_t>& data) noexcept {
-	pushData<size_t>(data.size());
-
-	for(size_t i = 0; i < data.size(); ++i){
-		pushData<int32_t>(data[i]);
-	}
+	pushLength(data.size());
+	pushData<int32_t>(data.data(), data.size());
 
 	return *this;
 }
 
 Archive& InArchive::operator << (const std::vector<int64_t>& data) noexcept {
-	pushData<size_t>(data.size());
-
-	for(size_t i = 0; i < data.size(); ++i){
-		pushData<int64_t>(data[i]);
-	}
+	pushLength(data.size());
+	pushData<int64_t>(data.data(), data.size());
 
 	return *this;
 }
 
 Archive& InArchive::operator << (const std::vector<float>& data) noexcept {
-	pushData<size_t>(data.size());
-
-	for(size_t i = 0; i < data.size(); ++i){
-		pushData<float>(data[i]);
-	}
+	pushLength(data.size());
+	pushData<float>(data.data(), data.size());
 
 	return *this;
 }
 
 Archive& InArchive::operator << (const std::vector<double>& data) noexcept {
-	pushData<size_t>(data.size());
-
-	for(size_t i = 0; i < data.size(); ++i){
-		pushData<double>(data[i]);
-	}
+	pushLength(data.size());
+	pushData<double>(data.data(), data.size());
 
 	return *this;
 }
 
 Archive& InArchive::operator << (const std::vector<long double>& data) noexcept {
-	pushData<size_t>(data.size());
-
-	for(size_t i = 0; i < data.size(); ++i){
-		pushData<long double>(data[i]);
-	}
+	pushLength(data.size());
+	pushData<long double>(data.data(), data.size());
 
 	return *this;
 }
 
 Archive& InArchive::operator << (const std::vector<std::string>& data) noexcept {
-	pushData<size_t>(data.size());
+	pushLength(data.size());
 
 	for(size_t i = 0; i < data.size(); ++i){
 		operator<<(data[i]);
@@ -507,7 +636,7 @@ Archive& InArchive::operator << (const std::vector<std::string>& data) noexcept
 }
 
 Archive& InArchive::operator << (const std::vector<std::wstring>& data) noexcept {
-	pushData<size_t>(data.size());
+	pushLength(data.size());
 
 	for(size_t i = 0; i < data.size(); ++i){
 		operator<<(data[i]);
@@ -516,11 +645,116 @@ Archive& InArchive::operator << (const std::vector<std::wstring>& data) noexcept
 	return *this;
 }
 
+Archive& InArchive::operator << (const std::string_view& data) noexcept {
+	pushLength(data.size());
+	pushData<char>(data.data(), data.size());
+	return *this;
+}
+
+Archive& InArchive::operator << (const std::span<const uint8_t>& data) noexcept {
+	pushLength(data.size());
+	pushData<uint8_t>(data.data(), data.size());
+	return *this;
+}
+
 OutArchive::OutArchive(std::span<const uint8_t> queue) noexcept : Archive(queue) {}
 
 OutArchive::OutArchive(const std::queue<uint8_t>& queue) noexcept : Archive(queue) {}
 
-OutArchive::OutArchive(std::queue<uint8_t>&& queue) noexcept : Archive(queue) {}
+OutArchive::OutArchive(std::queue<uint8_t>&& queue) noexcept : Archive(std::move(queue)) {}
+
+OutArchive::OutArchive(std::vector<uint8_t>&& buffer) noexcept : Archive(std::move(buffer)) {}
+
+OutArchive OutArchive::view(std::span<const uint8_t> data) noexcept {
+	OutArchive archive;
+	archive.borrow(data);
+	return archive;
+}
+
+bool OutArchive::enterSection(uint32_t& id) noexcept {
+	size_t length = 0;
+	if(!readSectionHeader(id, length)){
+		return false;
+	}
+
+	sectionEnds.push_back(tell() + length);
+
+	return true;
+}
+
+bool OutArchive::findSection(uint32_t id) noexcept {
+	const size_t cursor = tell();
+	const size_t limit = sectionEnds.empty() ? std::numeric_limits<size_t>::max() : sectionEnds.back();
+
+	while(tell() < limit){
+		uint32_t sectionID = 0;
+		size_t length = 0;
+		if(!readSectionHeader(sectionID, length)){
+			break;
+		}
+
+		if(sectionID == id){
+			sectionEnds.push_back(tell() + length);
+			return true;
+		}
+
+		seekTo(tell() + length);
+	}
+
+	seekTo(cursor);
+
+	return false;
+}
+
+void OutArchive::exitSection() noexcept {
+	if(sectionEnds.empty()){
+		return;
+	}
+
+	const size_t end = sectionEnds.back();
+	sectionEnds.pop_back();
+
+	if(tell() < end){
+		seekTo(end);
+	}
+}
+
+bool OutArchive::skipSection() noexcept {
+	uint32_t id = 0;
+	size_t length = 0;
+	if(!readSectionHeader(id, length)){
+		return false;
+	}
+
+	seekTo(tell() + length);
+
+	return true;
+}
+
+bool OutArchive::readSectionHeader(uint32_t& id, size_t& length) noexcept {
+	const size_t cursor = tell();
+
+	uint32_t sectionID = 0;
+	uint8_t bytes[sizeof(uint32_t)];
+	if(!popData<uint32_t>(sectionID) || !popBytes(bytes, sizeof(bytes))){
+		seekTo(cursor);
+		return false;
+	}
+
+	// Nested sections have to end within the section enclosing them, which corrupt data or a newer format could claim otherwise
+	const size_t end = sectionEnds.empty() ? tell() + size() : std::min(tell() + size(), sectionEnds.back());
+
+	const uint32_t sectionLength = decodeSectionLength(bytes);
+	if(tell() > end || sectionLength > end - tell()){
+		seekTo(cursor);
+		return false;
+	}
+
+	id = sectionID;
+	length = sectionLength;
+
+	return true;
+}
 
 Archive& OutArchive::operator << (bool& data) noexcept {
 	popData<bool>(data);
@@ -589,34 +823,33 @@ Archive& OutArchive::operator << (long double& data) noexcept {
 
 Archive& OutArchive::operator << (std::string& data) noexcept {
 	size_t size = 0;
-	popData<size_t>(size);
-
-	for(size_t i = 0; i < size; ++i){
-		char c;
-		if(popData<char>(c)){
-			data += c;
-		}
+	if(!popLength(size, sizeof(char))){
+		return *this;
 	}
 
+	const size_t offset = data.size();
+	data.resize(offset + size);
+	popData<char>(data.data() + offset, size);
+
 	return *this;
 }
 
 Archive& OutArchive::operator<<(std::wstring& data) noexcept {
 	size_t size = 0;
-	popData<size_t>(size);
-
-	for(size_t i = 0; i < size; ++i){
-		wchar_t c;
-		popData<wchar_t>(c);
-		data += c;
+	if(!popLength(size, sizeof(wchar_t))){
+		return *this;
 	}
 
+	const size_t offset = data.size();
+	data.resize(offset + size);
+	popData<wchar_t>(data.data() + offset, size);
+
 	return *this;
 }
 
 Archive& OutArchive::operator << (std::vector<bool>& data) noexcept {
 	size_t size = 0;
-	popData<size_t>(size);
+	popLength(size, sizeof(bool));
 	data.resize(size);
 
 	for(size_t i = 0; i < size; ++i){
@@ -630,151 +863,115 @@ Archive& OutArchive::operator << (std::vector<bool>& data) noexcept {
 
 Archive& OutArchive::operator << (std::vector<wchar_t>& data) noexcept {
 	size_t size = 0;
-	popData<size_t>(size);
+	popLength(size, sizeof(wchar_t));
 	data.resize(size);
-
-	for(size_t i = 0; i < size; ++i){
-		popData<wchar_t>(data[i]);
-	}
+	popData<wchar_t>(data.data(), size);
 
 	return *this;
 }
 
 Archive& OutArchive::operator << (std::vector<uint8_t>& data) noexcept {
 	size_t size = 0;
-	popData<size_t>(size);
+	popLength(size, sizeof(uint8_t));
 	data.resize(size);
-
-	for(size_t i = 0; i < size; ++i){
-		popData<uint8_t>(data[i]);
-	}
+	popData<uint8_t>(data.data(), size);
 
 	return *this;
 }
 
 Archive& OutArchive::operator << (std::vector<uint16_t>& data) noexcept {
 	size_t size = 0;
-	popData<size_t>(size);
+	popLength(size, sizeof(uint16_t));
 	data.resize(size);
-
-	for(size_t i = 0; i < size; ++i){
-		popData<uint16_t>(data[i]);
-	}
+	popData<uint16_t>(data.data(), size);
 
 	return *this;
 }
 
 Archive& OutArchive::operator << (std::vector<uint32_t>& data) noexcept {
 	size_t size = 0;
-	popData<size_t>(size);
+	popLength(size, sizeof(uint32_t));
 	data.resize(size);
-
-	for(size_t i = 0; i < size; ++i){
-		popData<uint32_t>(data[i]);
-	}
+	popData<uint32_t>(data.data(), size);
 
 	return *this;
 }
 
 Archive& OutArchive::operator << (std::vector<uint64_t>& data) noexcept {
 	size_t size = 0;
-	popData<size_t>(size);
+	popLength(size, sizeof(uint64_t));
 	data.resize(size);
-
-	for(size_t i = 0; i < size; ++i){
-		popData<uint64_t>(data[i]);
-	}
+	popData<uint64_t>(data.data(), size);
 
 	return *this;
 }
 
 Archive& OutArchive::operator << (std::vector<int8_t>& data) noexcept {
 	size_t size = 0;
-	popData<size_t>(size);
+	popLength(size, sizeof(int8_t));
 	data.resize(size);
-
-	for(size_t i = 0; i < size; ++i){
-		popData<int8_t>(data[i]);
-	}
+	popData<int8_t>(data.data(), size);
 
 	return *this;
 }
 
 Archive& OutArchive::operator << (std::vector<int16_t>& data) noexcept {
 	size_t size = 0;
-	popData<size_t>(size);
+	popLength(size, sizeof(int16_t));
 	data.resize(size);
-
-	for(size_t i = 0; i < size; ++i){
-		popData<int16_t>(data[i]);
-	}
+	popData<int16_t>(data.data(), size);
 
 	return *this;
 }
 
 Archive& OutArchive::operator << (std::vector<int32_t>& data) noexcept {
 	size_t size = 0;
-	popData<size_t>(size);
+	popLength(size, sizeof(int32_t));
 	data.resize(size);
-
-	for(size_t i = 0; i < size; ++i){
-		popData<int32_t>(data[i]);
-	}
+	popData<int32_t>(data.data(), size);
 
 	return *this;
 }
 
 Archive& OutArchive::operator << (std::vector<int64_t>& data) noexcept {
 	size_t size = 0;
-	popData<size_t>(size);
+	popLength(size, sizeof(int64_t));
 	data.resize(size);
-
-	for(size_t i = 0; i < size; ++i){
-		popData<int64_t>(data[i]);
-	}
+	popData<int64_t>(data.data(), size);
 
 	return *this;
 }
 
 Archive& OutArchive::operator << (std::vector<float>& data) noexcept {
 	size_t size = 0;
-	popData<size_t>(size);
+	popLength(size, sizeof(float));
 	data.resize(size);
-
-	for(size_t i = 0; i < size; ++i){
-		popData<float>(data[i]);
-	}
+	popData<float>(data.data(), size);
 
 	return *this;
 }
 
 Archive& OutArchive::operator << (std::vector<double>& data) noexcept {
 	size_t size = 0;
-	popData<size_t>(size);
+	popLength(size, sizeof(double));
 	data.resize(size);
-
-	for(size_t i = 0; i < size; ++i){
-		popData<double>(data[i]);
-	}
+	popData<double>(data.data(), size);
 
 	return *this;
 }
 
 Archive& OutArchive::operator << (std::vector<long double>& data) noexcept {
 	size_t size = 0;
-	popData<size_t>(size);
+	popLength(size, sizeof(long double));
 	data.resize(size);
-
-	for(size_t i = 0; i < size; ++i){
-		popData<long double>(data[i]);
-	}
+	popData<long double>(data.data(), size);
 
 	return *this;
 }
 
 Archive& OutArchive::operator << (std::vector<std::string>& data) noexcept {
 	size_t size = 0;
-	popData<size_t>(size);
+	popLength(size, 1);
 	data.resize(size);
 
 	for(size_t i = 0; i < size; ++i){
@@ -786,7 +983,7 @@ Archive& OutArchive::operator << (std::vector<std::string>& data) noexcept {
 
 Archive& OutArchive::operator<<(std::vector<std::wstring>& data) noexcept {
 	size_t size = 0;
-	popData<size_t>(size);
+	popLength(size, 1);
 	data.resize(size);
 
 	for(size_t i = 0; i < size; ++i){
@@ -794,4 +991,46 @@ Archive& OutArchive::operator<<(std::vector<std::wstring>& data) noexcept {
 	}
 
 	return *this;
-}
\ No newline at end of file
+}
+
+Archive& OutArchive::operator << (std::string_view& data) noexcept {
+	const size_t cursor = tell();
+
+	size_t size = 0;
+	if(!popLength(size, sizeof(char))){
+		data = {};
+		return *this;
+	}
+
+	const uint8_t* bytes = viewBytes(size);
+	if(bytes == nullptr){
+		seekTo(cursor);
+		data = {};
+		return *this;
+	}
+
+	data = std::string_view(reinterpret_cast<const char*>(bytes), size);
+
+	return *this;
+}
+
+Archive& OutArchive::operator << (std::span<const uint8_t>& data) noexcept {
+	const size_t cursor = tell();
+
+	size_t size = 0;
+	if(!popLength(size, sizeof(uint8_t))){
+		data = {};
+		return *this;
+	}
+
+	const uint8_t* bytes = viewBytes(size);
+	if(bytes == nullptr){
+		seekTo(cursor);
+		data = {};
+		return *this;
+	}
+
+	data = std::span<const uint8_t>(bytes, size);
+
+	return *this;
+}
@@ -1,17 +1,37 @@
 #ifndef CMF_ARCHIVE_H
 #define CMF_ARCHIVE_H
 
+#include <algorithm>
+#include <bit>
 #include <cstdint>
+#include <cstring>
+#include <limits>
 #include <queue>
 #include <span>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <vector>
 
+class Object;
+
 /**
  * @brief The base archive class, functioning as the backbone and implementation of internal works for the in-only and out-only archives.
  */
 class Archive {
 public:
+	/**
+	 * @brief The way primitive data is laid out in the archive.
+	 * Native writes every value at its full in-memory width and byte order, which is the fastest but platform-dependent.
+	 * Compact writes unsigned integers and lengths as LEB128 varints, signed integers as zigzag varints,
+	 * and floating point values as fixed-width little-endian, resulting in smaller data that is identical on every platform.
+	 * Both sides have to use the same encoding.
+	 */
+	enum class Encoding : uint8_t {
+		Native,
+		Compact
+	};
+
 	/**
 	 * @brief Default constructor.
 	 */
@@ -35,7 +55,16 @@ public:
 	 */
 	Archive(std::queue<uint8_t>&& queue) noexcept;
 
-	inline size_t size() const noexcept { return byteBuffer.size(); }
+	/**
+	 * @brief Constructor which takes over the given byte buffer without copying it.
+	 * @param buffer Byte vector containing the archive data. Vector is empty after constructor finishes execution.
+	 */
+	Archive(std::vector<uint8_t>&& buffer) noexcept;
+
+	/**
+	 * @return The number of bytes in the archive that have not been read yet.
+	 */
+	virtual size_t size() const noexcept { return dataSize() - readCursor; }
 
 	/**
 	 * @brief Default destructor.
@@ -253,11 +282,67 @@ public:
 	virtual Archive& operator << (std::vector<std::wstring>& data) noexcept = 0;
 
 	/**
-	 * @brief Converts the archive to a byte array.
+	 * @brief The in/out operator that reads a string view from internal data buffer, or adds the viewed string to the internal data buffer.
+	 * When reading, the view points into the archive data and is only valid as long as that data is.
+	 * @param data The data being put in / given out.
+	 * @return Reference to the archive called on.
+	 */
+	virtual Archive& operator << (std::string_view& data) noexcept = 0;
+
+	/**
+	 * @brief The in/out operator that reads a byte span from internal data buffer, or adds the viewed bytes to the internal data buffer.
+	 * When reading, the span points into the archive data and is only valid as long as that data is.
+	 * @param data The data being put in / given out.
+	 * @return Reference to the archive called on.
+	 */
+	virtual Archive& operator << (std::span<const uint8_t>& data) noexcept = 0;
+
+	/**
+	 * @brief Converts the archive to a byte array. Only the data that has not yet been read out of the archive is copied.
 	 * @param buffer The byte vector the data is put in.
 	 */
 	void toByteArray(std::vector<uint8_t>& buffer) const noexcept;
 
+	/**
+	 * @brief Moves the archive data into the given byte array without copying it. The archive is empty afterwards.
+	 * @param buffer The byte vector the data is moved into.
+	 */
+	void takeByteArray(std::vector<uint8_t>& buffer) noexcept;
+
+	/**
+	 * @return The encoding used for primitive data in the archive.
+	 */
+	inline Encoding getEncoding() const noexcept { return encoding; }
+
+	/**
+	 * @brief Sets the encoding used for primitive data in the archive. Should be set before any data flows through the archive.
+	 * @param value The new encoding.
+	 */
+	inline void setEncoding(Encoding value) noexcept { encoding = value; }
+
+	/**
+	 * @brief Writes / reads a reference to another object. Only archives which serialize whole object graphs support references,
+	 * every object is then stored once and all references to it are restored to the same instance.
+	 * @param object The referenced object being written / the variable being set to the referenced object.
+	 * @return True if successful, false if the archive does not support object references or the reference is invalid.
+	 */
+	virtual bool objectReference([[maybe_unused]] Object*& object) noexcept { return false; }
+
+	/**
+	 * @brief Creates a section ID from a section name, so sections can be tagged by name without storing it.
+	 * @param name The name of the section.
+	 * @return The 32-bit FNV-1a hash of the name.
+	 */
+	static constexpr uint32_t sectionID(std::string_view name) noexcept {
+		uint32_t hash = 2166136261u;
+
+		for(const char c : name){
+			hash = (hash ^ (uint8_t) c) * 16777619u;
+		}
+
+		return hash;
+	}
+
 protected:
 	/**
 	 * @brief Pushes a byte of data to the internal data buffer.
@@ -272,6 +357,92 @@ protected:
 	 */
 	bool popDataPoint(uint8_t& data) noexcept;
 
+	/**
+	 * @brief Appends a block of bytes to the end of the internal buffer with a single copy.
+	 * @param data Pointer to the bytes being pushed.
+	 * @param count Number of bytes being pushed.
+	 */
+	virtual void pushBytes(const uint8_t* data, size_t count) noexcept;
+
+	/**
+	 * @brief Copies a block of bytes from the read cursor of the internal buffer and advances the cursor.
+	 * Nothing is consumed if fewer than count bytes are available.
+	 * @param data Pointer to the memory the bytes are copied to.
+	 * @param count Number of bytes being popped.
+	 * @return True if successful, false otherwise.
+	 */
+	virtual bool popBytes(uint8_t* data, size_t count) noexcept;
+
+	/**
+	 * @brief Gives direct access to a block of bytes at the read cursor of the internal buffer and advances the cursor.
+	 * Nothing is consumed if fewer than count bytes are available, or if the archive does not keep its data in memory.
+	 * @param count Number of bytes being viewed.
+	 * @return Pointer to the viewed bytes, nullptr if there is not enough data.
+	 */
+	virtual const uint8_t* viewBytes(size_t count) noexcept;
+
+	/**
+	 * @return The current position of the read cursor.
+	 */
+	virtual size_t tell() const noexcept { return readCursor; }
+
+	/**
+	 * @brief Moves the read cursor back to a position previously given by tell().
+	 * @param cursor The position of the read cursor.
+	 */
+	virtual void seekTo(size_t cursor) noexcept;
+
+	/**
+	 * @brief Overwrites a block of bytes that was already pushed to the internal buffer.
+	 * @param position Position of the first byte being overwritten, counted the same way as size().
+	 * @param data Pointer to the new bytes.
+	 * @param count Number of bytes being overwritten.
+	 */
+	virtual void patchBytes(size_t position, const uint8_t* data, size_t count) noexcept;
+
+	/**
+	 * @brief Encodes a section length as a fixed-width little-endian value, independent of the archive encoding,
+	 * so it can be patched in place once the section is done.
+	 * @param length The length of the section.
+	 * @param bytes The 4 bytes being set to the encoded length.
+	 */
+	static void encodeSectionLength(uint32_t length, uint8_t* bytes) noexcept;
+
+	/**
+	 * @brief Decodes a section length previously encoded with encodeSectionLength().
+	 * @param bytes The 4 bytes of the encoded length.
+	 * @return The length of the section.
+	 */
+	static uint32_t decodeSectionLength(const uint8_t* bytes) noexcept;
+
+	/**
+	 * @brief Reserves space in the internal buffer for the given number of bytes on top of the unread data.
+	 * @param count The number of bytes to reserve space for.
+	 */
+	void reserveBytes(size_t count) noexcept;
+
+	/**
+	 * @brief Makes the archive read directly from the given data instead of its own buffer.
+	 * Any data already in the archive is discarded.
+	 * @param data The borrowed data, has to outlive the archive.
+	 */
+	void borrow(std::span<const uint8_t> data) noexcept;
+
+	/**
+	 * @brief Pushes the length of a string or a vector to the internal buffer.
+	 * @param length The number of elements that follow.
+	 */
+	void pushLength(size_t length) noexcept;
+
+	/**
+	 * @brief Pops the length of a string or a vector from the internal buffer.
+	 * The length is rejected if the archive does not hold enough data for that many elements.
+	 * @param length The variable being set to the number of elements that follow, 0 if the length is invalid.
+	 * @param elementSize The minimal size of a single element in bytes.
+	 * @return True if successful, false otherwise.
+	 */
+	bool popLength(size_t& length, size_t elementSize) noexcept;
+
 	/**
 	 * @brief Default deleted template for pushing templated data type to the internal buffer.
 	 * @tparam T The type of data being pushed to the internal buffer.
@@ -288,14 +459,39 @@ protected:
 	 */
 	template<typename T>
 	void pushData(T data) noexcept requires (std::is_fundamental<T>::value) {
-		uint8_t* dataAsBuffer = reinterpret_cast<uint8_t*>(&data);
-		if(dataAsBuffer == nullptr){
+		if constexpr(sizeof(T) > 1){
+			if(encoding == Encoding::Compact){
+				pushCompact<T>(data);
+				return;
+			}
+		}
+
+		pushBytes(reinterpret_cast<const uint8_t*>(&data), sizeof(T));
+	}
+
+	/**
+	 * @brief Pushes a contiguous array of primitive data to the internal buffer with a single copy.
+	 * @tparam T The type of data being pushed to the internal buffer.
+	 * @param data Pointer to the first element being pushed.
+	 * @param count Number of elements being pushed.
+	 */
+	template<typename T>
+	void pushData(const T* data, size_t count) noexcept requires (std::is_fundamental<T>::value) {
+		if(data == nullptr || count == 0){
 			return;
 		}
 
-		for(size_t i = 0; i < sizeof(T); ++i){
-			pushDataPoint(dataAsBuffer[i]);
+		if constexpr(sizeof(T) > 1){
+			if(encoding == Encoding::Compact){
+				for(size_t i = 0; i < count; ++i){
+					pushCompact<T>(data[i]);
+				}
+
+				return;
+			}
 		}
+
+		pushBytes(reinterpret_cast<const uint8_t*>(data), count * sizeof(T));
 	}
 
 	/**
@@ -315,22 +511,163 @@ protected:
 	 */
 	template<typename T>
 	bool popData(T& data) noexcept requires (std::is_fundamental<T>::value) {
-		uint8_t* dataAsBuffer = reinterpret_cast<uint8_t*>(&data);
-		if(dataAsBuffer == nullptr){
+		if constexpr(sizeof(T) > 1){
+			if(encoding == Encoding::Compact){
+				return popCompact<T>(data);
+			}
+		}
+
+		return popBytes(reinterpret_cast<uint8_t*>(&data), sizeof(T));
+	}
+
+	/**
+	 * @brief Pops a contiguous array of primitive data from the internal buffer with a single copy.
+	 * @tparam T The type of data being popped from the internal buffer.
+	 * @param data Pointer to the first element being set.
+	 * @param count Number of elements being popped.
+	 * @return True if successful, false otherwise.
+	 */
+	template<typename T>
+	bool popData(T* data, size_t count) noexcept requires (std::is_fundamental<T>::value) {
+		if(count == 0){
+			return true;
+		}
+
+		if(data == nullptr){
 			return false;
 		}
 
-		for(size_t i = 0; i < sizeof(T); ++i){
-			if(!popDataPoint(dataAsBuffer[i])){
-				return false;
+		if constexpr(sizeof(T) > 1){
+			if(encoding == Encoding::Compact){
+				const size_t cursor = tell();
+
+				for(size_t i = 0; i < count; ++i){
+					if(!popCompact<T>(data[i])){
+						seekTo(cursor);
+						return false;
+					}
+				}
+
+				return true;
 			}
 		}
 
-		return true;
+		return popBytes(reinterpret_cast<uint8_t*>(data), count * sizeof(T));
 	}
 
 private:
-	std::queue<uint8_t> byteBuffer;
+	/**
+	 * @brief Pushes a value as a LEB128 varint, 7 bits per byte with the highest bit marking that more bytes follow.
+	 * @param value The value being pushed.
+	 */
+	void pushVarint(uint64_t value) noexcept;
+
+	/**
+	 * @brief Pops a LEB128 varint. Nothing is consumed if the varint is incomplete or does not fit the given width.
+	 * @param value The variable being set to the popped value.
+	 * @param width The size in bytes of the type the value is meant for.
+	 * @return True if successful, false otherwise.
+	 */
+	bool popVarint(uint64_t& value, size_t width) noexcept;
+
+	/**
+	 * @brief Pushes a multi-byte primitive value in the compact encoding.
+	 * Character types are treated as unsigned so their layout does not depend on the platform signedness,
+	 * and long double is narrowed to double since its width differs between platforms.
+	 * @tparam T The type of data being pushed.
+	 * @param data The data being pushed.
+	 */
+	template<typename T>
+	void pushCompact(T data) noexcept {
+		if constexpr(std::is_floating_point<T>::value){
+			using F = std::conditional_t<sizeof(T) <= sizeof(double), T, double>;
+			const F value = static_cast<F>(data);
+
+			uint8_t bytes[sizeof(F)];
+			memcpy(bytes, &value, sizeof(F));
+			if constexpr(std::endian::native == std::endian::big){
+				std::reverse(bytes, bytes + sizeof(F));
+			}
+
+			pushBytes(bytes, sizeof(F));
+		}else{
+			using U = std::make_unsigned_t<T>;
+
+			if constexpr(std::is_signed<T>::value && !std::is_same<T, wchar_t>::value){
+				pushVarint(static_cast<U>(static_cast<U>(static_cast<U>(data) << 1) ^ static_cast<U>(data >> (sizeof(T) * 8 - 1))));
+			}else{
+				pushVarint(static_cast<U>(data));
+			}
+		}
+	}
+
+	/**
+	 * @brief Pops a multi-byte primitive value in the compact encoding. Nothing is consumed on failure.
+	 * @tparam T The type of data being popped.
+	 * @param data The variable being set to the popped value.
+	 * @return True if successful, false otherwise.
+	 */
+	template<typename T>
+	bool popCompact(T& data) noexcept {
+		if constexpr(std::is_floating_point<T>::value){
+			using F = std::conditional_t<sizeof(T) <= sizeof(double), T, double>;
+
+			uint8_t bytes[sizeof(F)];
+			if(!popBytes(bytes, sizeof(F))){
+				return false;
+			}
+
+			if constexpr(std::endian::native == std::endian::big){
+				std::reverse(bytes, bytes + sizeof(F));
+			}
+
+			F value;
+			memcpy(&value, bytes, sizeof(F));
+			data = static_cast<T>(value);
+
+			return true;
+		}else{
+			using U = std::make_unsigned_t<T>;
+
+			uint64_t raw = 0;
+			if(!popVarint(raw, sizeof(T))){
+				return false;
+			}
+
+			const U value = static_cast<U>(raw);
+
+			if constexpr(std::is_signed<T>::value && !std::is_same<T, wchar_t>::value){
+				data = static_cast<T>(static_cast<U>(value >> 1) ^ static_cast<U>(0 - (value & 1)));
+			}else{
+				data = static_cast<T>(value);
+			}
+
+			return true;
+		}
+	}
+
+private:
+	/**
+	 * @return Pointer to the start of the data the archive is reading from.
+	 */
+	inline const uint8_t* readData() const noexcept { return borrowing ? borrowedData.data() : byteBuffer.data(); }
+
+	/**
+	 * @return Total size of the data the archive is reading from, including the already read part.
+	 */
+	inline size_t dataSize() const noexcept { return borrowing ? borrowedData.size() : byteBuffer.size(); }
+
+	/**
+	 * @brief Copies the unread part of the borrowed data into the owned buffer, ending the borrow.
+	 */
+	void detach() noexcept;
+
+private:
+	std::vector<uint8_t> byteBuffer;
+	std::span<const uint8_t> borrowedData;
+	size_t readCursor = 0;
+	bool borrowing = false;
+	Encoding encoding = Encoding::Native;
 };
 
 /**
@@ -362,6 +699,31 @@ public:
 	 */
 	InArchive(std::queue<uint8_t>&& queue) noexcept;
 
+	/**
+	 * @brief Constructor which takes over the given byte buffer without copying it.
+	 * @param buffer Byte vector containing the archive data. Vector is empty after constructor finishes execution.
+	 */
+	InArchive(std::vector<uint8_t>&& buffer) noexcept;
+
+	/**
+	 * @brief Reserves space in the internal buffer for the given number of bytes on top of the data already in it,
+	 * so that pushing that much data does not reallocate the buffer.
+	 * @param size The number of bytes to reserve space for.
+	 */
+	void reserve(size_t size) noexcept;
+
+	/**
+	 * @brief Starts a length-prefixed section. All data pushed until the matching endSection() call belongs to the section,
+	 * which readers can find by its ID and skip over without decoding its contents. Sections can be nested.
+	 * @param id The ID of the section, see Archive::sectionID() for tagging sections by name.
+	 */
+	void beginSection(uint32_t id) noexcept;
+
+	/**
+	 * @brief Ends the most recently started section and fills in its length.
+	 */
+	void endSection() noexcept;
+
 	/**
 	 * @brief The in operator that adds given data to the internal buffer.
 	 * @param data The data flowing into the archive.
@@ -572,6 +934,20 @@ public:
 	 */
 	virtual Archive& operator << (std::vector<std::wstring>& data) noexcept override final;
 
+	/**
+	 * @brief The in operator that adds given data to the internal buffer.
+	 * @param data The data flowing into the archive.
+	 * @return The reference to the archive called on.
+	 */
+	virtual Archive& operator << (std::string_view& data) noexcept override final;
+
+	/**
+	 * @brief The in operator that adds given data to the internal buffer.
+	 * @param data The data flowing into the archive.
+	 * @return The reference to the archive called on.
+	 */
+	virtual Archive& operator << (std::span<const uint8_t>& data) noexcept override final;
+
 	/**
 	 * @brief The in operator that adds given data to the internal buffer.
 	 * @param data The data flowing into the archive.
@@ -781,6 +1157,23 @@ public:
 	 * @return The reference to the archive called on.
 	 */
 	virtual Archive& operator << (const std::vector<std::wstring>& data) noexcept;
+
+	/**
+	 * @brief The in operator that adds given data to the internal buffer.
+	 * @param data The data flowing into the archive.
+	 * @return The reference to the archive called on.
+	 */
+	virtual Archive& operator << (const std::string_view& data) noexcept;
+
+	/**
+	 * @brief The in operator that adds given data to the internal buffer.
+	 * @param data The data flowing into the archive.
+	 * @return The reference to the archive called on.
+	 */
+	virtual Archive& operator << (const std::span<const uint8_t>& data) noexcept;
+
+private:
+	std::vector<size_t> sectionStarts;
 };
 
 /**
@@ -812,6 +1205,12 @@ public:
 	 */
 	OutArchive(std::queue<uint8_t>&& queue) noexcept;
 
+	/**
+	 * @brief Constructor which takes over the given byte buffer without copying it.
+	 * @param buffer Byte vector containing the archive data. Vector is empty after constructor finishes execution.
+	 */
+	OutArchive(std::vector<uint8_t>&& buffer) noexcept;
+
 	/**
 	 * @brief The out operator that retrieves given data from the internal buffer.
 	 * @param data The variable being set to the data in the internal buffer.
@@ -1021,6 +1420,102 @@ public:
 	 * @return The reference to the archive called on.
 	 */
 	virtual Archive& operator << (std::vector<std::wstring>& data) noexcept override final;
+
+	/**
+	 * @brief The out operator that retrieves a view of a string from the internal buffer without copying it.
+	 * The view is empty and nothing is consumed if the archive does not keep its data in memory.
+	 * @param data The view being set to the string in the internal buffer. Only valid as long as the archive data is.
+	 * @return The reference to the archive called on.
+	 */
+	virtual Archive& operator << (std::string_view& data) noexcept override final;
+
+	/**
+	 * @brief The out operator that retrieves a view of a byte vector from the internal buffer without copying it.
+	 * The view is empty and nothing is consumed if the archive does not keep its data in memory.
+	 * @param data The span being set to the bytes in the internal buffer. Only valid as long as the archive data is.
+	 * @return The reference to the archive called on.
+	 */
+	virtual Archive& operator << (std::span<const uint8_t>& data) noexcept override final;
+
+	/**
+	 * @brief Retrieves a view of a vector of primitive data from the internal buffer without copying it.
+	 * Since the data is not copied, the view is only given if the elements in the buffer are properly aligned for type T.
+	 * @tparam T The type of elements in the vector.
+	 * @param data The span being set to the elements in the internal buffer. Only valid as long as the archive data is.
+	 * Multi-byte elements can not be viewed in compact encoding, since they are not stored at their in-memory width.
+	 * @return True if successful, false if there is not enough data or the data is not aligned. Nothing is consumed on failure.
+	 */
+	template<typename T>
+	bool viewArray(std::span<const T>& data) noexcept requires (std::is_fundamental<T>::value && !std::is_same<T, bool>::value) {
+		if(getEncoding() == Encoding::Compact && sizeof(T) > 1){
+			return false;
+		}
+
+		const size_t cursor = tell();
+
+		size_t length = 0;
+		if(!popLength(length, sizeof(T))){
+			seekTo(cursor);
+			return false;
+		}
+
+		const uint8_t* bytes = viewBytes(length * sizeof(T));
+		if(bytes == nullptr || reinterpret_cast<uintptr_t>(bytes) % alignof(T) != 0){
+			seekTo(cursor);
+			return false;
+		}
+
+		data = std::span<const T>(reinterpret_cast<const T*>(bytes), length);
+
+		return true;
+	}
+
+	/**
+	 * @brief Creates an archive that reads directly from the given data instead of copying it.
+	 * The data is borrowed and has to outlive the archive, as well as all views retrieved from it.
+	 * @param data The span of byte data.
+	 * @return The archive reading from the borrowed data.
+	 */
+	static OutArchive view(std::span<const uint8_t> data) noexcept;
+
+	/**
+	 * @brief Enters the section at the read position, whatever its ID.
+	 * @param id The variable being set to the ID of the entered section.
+	 * @return True if successful, false if there is no complete section at the read position. Nothing is consumed on failure.
+	 */
+	bool enterSection(uint32_t& id) noexcept;
+
+	/**
+	 * @brief Looks for the section with the given ID among the sections following the read position and enters it.
+	 * Sections with other IDs are skipped without decoding them. The search stops at the end of the current section.
+	 * @param id The ID of the section, see Archive::sectionID() for sections tagged by name.
+	 * @return True if the section was found, false otherwise. Nothing is consumed if the section was not found.
+	 */
+	bool findSection(uint32_t id) noexcept;
+
+	/**
+	 * @brief Exits the most recently entered section, skipping any of its data that has not been read,
+	 * such as fields written by a newer version of the object.
+	 */
+	void exitSection() noexcept;
+
+	/**
+	 * @brief Skips the section at the read position without decoding its contents.
+	 * @return True if successful, false if there is no complete section at the read position.
+	 */
+	bool skipSection() noexcept;
+
+private:
+	std::vector<size_t> sectionEnds;
+
+	/**
+	 * @brief Reads the header of the section at the read position.
+	 * @param id The variable being set to the ID of the section.
+	 * @param length The variable being set to the length of the section data.
+	 * @return True if successful, false if there is no complete section at the read position, or it would extend past the end of the current section.
+	 * Nothing is consumed on failure.
+	 */
+	bool readSectionHeader(uint32_t& id, size_t& length) noexcept;
 };
 
 #endif //CMF_ARCHIVE_H
\ No newline at end of file
@@ -0,0 +1,228 @@
+#ifndef CMF_COPYONWRITE_H
+#define CMF_COPYONWRITE_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Holds a value which is read much more often than it is changed, in the style of read-copy-update.
+ * Readers get the current immutable snapshot of the value without locking, and writers publish a modified copy of it with an atomic swap.
+ * Replaced snapshots, and any other objects retired by writers, are deleted only once no reader can still be using them,
+ * which is the first moment after their retirement at which no reader is active. A reader ending while a writer holds the lock leaves the deletion to that writer.
+ * Writers are serialized between themselves, but never wait for readers, so readers may also write.
+ * @tparam T The type of the value. Has to be copy constructible.
+ */
+template<typename T>
+class CopyOnWrite {
+public:
+	/**
+	 * @brief Guard which keeps the snapshot it was created with alive while it exists.
+	 */
+	class ReadGuard {
+	public:
+		/**
+		 * @brief Deleted copy constructor, since each guard is a single active reader.
+		 */
+		ReadGuard(const ReadGuard&) = delete;
+
+		/**
+		 * @brief Deleted copy assignment.
+		 */
+		ReadGuard& operator = (const ReadGuard&) = delete;
+
+		/**
+		 * @brief Ends the read, deleting retired objects if this was the last active reader.
+		 */
+		inline ~ReadGuard() noexcept {
+			owner.endRead();
+		}
+
+		/**
+		 * @return True if a value has been published, false otherwise.
+		 */
+		inline explicit operator bool() const noexcept {
+			return value != nullptr;
+		}
+
+		inline const T& operator * () const noexcept { return *value; }
+		inline const T* operator -> () const noexcept { return value; }
+
+	private:
+		friend class CopyOnWrite;
+
+		CopyOnWrite& owner;
+		const T* value;
+
+	private:
+		inline ReadGuard(CopyOnWrite& owner, const T* value) noexcept : owner(owner), value(value) {}
+	};
+
+public:
+	/**
+	 * @brief Default empty constructor, no value is published until the first update.
+	 */
+	inline CopyOnWrite() noexcept = default;
+
+	/**
+	 * @brief Deleted copy constructor, since readers hold references to the snapshots.
+	 */
+	CopyOnWrite(const CopyOnWrite&) = delete;
+
+	/**
+	 * @brief Deleted copy assignment.
+	 */
+	CopyOnWrite& operator = (const CopyOnWrite&) = delete;
+
+	/**
+	 * @brief Deletes the current snapshot and all retired objects. There may be no active readers.
+	 */
+	inline ~CopyOnWrite() noexcept {
+		std::lock_guard guard(writeMutex);
+
+		reclaim();
+		delete current.load(std::memory_order_acquire);
+	}
+
+	/**
+	 * @brief Starts a read of the current snapshot, without locking.
+	 * @return Guard giving access to the snapshot, which stays valid until the guard is destroyed.
+	 */
+	inline ReadGuard read() const noexcept {
+		CopyOnWrite& self = const_cast<CopyOnWrite&>(*this);
+
+		// Pairs with the swap in update, a reader which is not counted by a writer is guaranteed to see the new snapshot
+		self.readers.fetch_add(1, std::memory_order_seq_cst);
+		return ReadGuard(self, current.load(std::memory_order_seq_cst));
+	}
+
+	/**
+	 * @brief Publishes a modified copy of the current value. The previous snapshot is retired.
+	 * @param modify Function called with the copy, which is default constructed if no value was published yet.
+	 */
+	template<typename F>
+	inline void update(F&& modify) noexcept {
+		WriteGuard guard(*this);
+
+		const T* previous = current.load(std::memory_order_acquire);
+		T* next = previous != nullptr ? new T(*previous) : new T();
+
+		modify(*next);
+
+		current.exchange(next, std::memory_order_seq_cst);
+
+		if(previous != nullptr){
+			retireLocked(previous);
+		}
+
+		tryReclaim();
+	}
+
+	/**
+	 * @brief Deletes the given object once no reader can still be using it. Used for objects reachable only through the replaced snapshots.
+	 * @tparam U The type of the object.
+	 * @tparam D The type of the deleter, a stateless function object called with the object instead of deleting it, if given.
+	 * @param object The object being deleted.
+	 */
+	template<typename U, typename D = std::default_delete<const U>>
+	inline void retire(const U* object, [[maybe_unused]] D deleter = D()) noexcept {
+		if(object == nullptr){
+			return;
+		}
+
+		WriteGuard guard(*this);
+
+		retireLocked<U, D>(object);
+		tryReclaim();
+	}
+
+private:
+	/**
+	 * @brief An object waiting to be deleted, along with the function deleting it.
+	 */
+	struct Retired {
+		const void* object;
+		void (*destroy)(const void*);
+	};
+
+	/**
+	 * @brief Lock of the write mutex, which after unlocking reclaims on behalf of readers that ended while it was held.
+	 */
+	class WriteGuard {
+	public:
+		inline explicit WriteGuard(CopyOnWrite& owner) noexcept : owner(owner) { owner.writeMutex.lock(); }
+
+		inline ~WriteGuard() noexcept {
+			owner.writeMutex.unlock();
+			owner.handleReclaimRequest();
+		}
+
+	private:
+		CopyOnWrite& owner;
+	};
+
+	std::atomic<T*> current = nullptr;
+	std::atomic_size_t readers = 0;
+	std::atomic_bool hasRetired = false;
+	std::atomic_bool reclaimRequest = false; // Set by a reader which found the write mutex locked, for the holder to reclaim after unlocking
+	std::mutex writeMutex;
+	std::vector<Retired> retired;
+
+private:
+	template<typename U, typename D = std::default_delete<const U>>
+	inline void retireLocked(const U* object) noexcept {
+		retired.push_back({ object, [](const void* object){ D()(static_cast<const U*>(object)); } });
+		hasRetired.store(true, std::memory_order_release);
+	}
+
+	/**
+	 * @brief Deletes all retired objects if no reader is active. Has to be called with the write mutex locked.
+	 */
+	inline void tryReclaim() noexcept {
+		if(readers.load(std::memory_order_seq_cst) == 0){
+			reclaim();
+		}
+	}
+
+	/**
+	 * @brief Deletes all retired objects. Has to be called with the write mutex locked.
+	 */
+	inline void reclaim() noexcept {
+		for(const Retired& entry : retired){
+			entry.destroy(entry.object);
+		}
+
+		retired.clear();
+		hasRetired.store(false, std::memory_order_release);
+	}
+
+	inline void endRead() noexcept {
+		if(readers.fetch_sub(1, std::memory_order_seq_cst) != 1 || !hasRetired.load(std::memory_order_acquire)){
+			return;
+		}
+
+		reclaimRequest.store(true, std::memory_order_seq_cst);
+		handleReclaimRequest();
+	}
+
+	/**
+	 * @brief Reclaims on behalf of readers which ended with the write mutex locked. Called after unlocking it, or by such a reader.
+	 * If the mutex is locked again, the request stays for its holder, which checks it after unlocking.
+	 */
+	inline void handleReclaimRequest() noexcept {
+		while(reclaimRequest.load(std::memory_order_seq_cst)){
+			std::unique_lock guard(writeMutex, std::try_to_lock);
+			if(!guard.owns_lock()){
+				return;
+			}
+
+			reclaimRequest.store(false, std::memory_order_relaxed);
+			tryReclaim();
+		}
+	}
+};
+
+#endif //CMF_COPYONWRITE_H
@@ -0,0 +1,15 @@
+#include "CountingArchive.h"
+
+size_t CountingArchive::size() const noexcept {
+	return count;
+}
+
+void CountingArchive::pushBytes(const uint8_t* data, size_t count) noexcept {
+	if(data == nullptr){
+		return;
+	}
+
+	this->count += count;
+}
+
+void CountingArchive::patchBytes([[maybe_unused]] size_t position, [[maybe_unused]] const uint8_t* data, [[maybe_unused]] size_t count) noexcept {}
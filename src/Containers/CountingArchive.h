@@ -0,0 +1,44 @@
+#ifndef CMF_COUNTINGARCHIVE_H
+#define CMF_COUNTINGARCHIVE_H
+
+#include <cstdint>
+#include "Containers/Archive.h"
+
+/**
+ * @brief An in-only archive which does not store any data, it only counts the number of bytes flowing into it.
+ * Used as a pre-pass to measure how much space serializing something takes, so the real archive can be allocated once.
+ * The encoding has to match the one of the real archive for the measured size to be exact.
+ */
+class CountingArchive : public InArchive {
+public:
+	/**
+	 * @brief Default empty constructor.
+	 */
+	CountingArchive() noexcept = default;
+
+	/**
+	 * @return The number of bytes that flowed into the archive.
+	 */
+	virtual size_t size() const noexcept override;
+
+protected:
+	/**
+	 * @brief Counts the pushed bytes without storing them.
+	 * @param data Pointer to the bytes being pushed.
+	 * @param count Number of bytes being pushed.
+	 */
+	virtual void pushBytes(const uint8_t* data, size_t count) noexcept override;
+
+	/**
+	 * @brief Nothing is stored, so there is nothing to patch.
+	 * @param position Position of the first byte being overwritten.
+	 * @param data Pointer to the new bytes.
+	 * @param count Number of bytes being overwritten.
+	 */
+	virtual void patchBytes(size_t position, const uint8_t* data, size_t count) noexcept override;
+
+private:
+	size_t count = 0;
+};
+
+#endif //CMF_COUNTINGARCHIVE_H
@@ -0,0 +1,326 @@
+#ifndef CMF_FLATMAP_H
+#define CMF_FLATMAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief An associative container keeping its elements sorted by key in a single contiguous array.
+ * Lookups are binary searches over contiguous memory, and the whole map takes a single heap allocation,
+ * which makes it a better fit than node-based maps for small maps that are looked up much more often than modified.
+ * Insertion and removal move the elements after the affected position, and invalidate iterators and references past it.
+ * The interface follows the commonly used subset of std::map.
+ * @tparam K The type of keys.
+ * @tparam V The type of values.
+ * @tparam Compare The comparison used to order the keys.
+ */
+template<typename K, typename V, typename Compare = std::less<K>>
+class FlatMap {
+public:
+	using value_type = std::pair<K, V>;
+	using iterator = typename std::vector<value_type>::iterator;
+	using const_iterator = typename std::vector<value_type>::const_iterator;
+
+	inline iterator begin() noexcept { return elements.begin(); }
+	inline iterator end() noexcept { return elements.end(); }
+	inline const_iterator begin() const noexcept { return elements.begin(); }
+	inline const_iterator end() const noexcept { return elements.end(); }
+
+	/**
+	 * @return The number of elements in the map.
+	 */
+	inline size_t size() const noexcept {
+		return elements.size();
+	}
+
+	/**
+	 * @return True if the map holds no elements, false otherwise.
+	 */
+	inline bool empty() const noexcept {
+		return elements.empty();
+	}
+
+	/**
+	 * @brief Reserves space for the given number of elements, so inserting up to it does not reallocate.
+	 * @param count The number of elements.
+	 */
+	inline void reserve(size_t count) noexcept {
+		elements.reserve(count);
+	}
+
+	/**
+	 * @brief Removes all elements from the map.
+	 */
+	inline void clear() noexcept {
+		elements.clear();
+	}
+
+	/**
+	 * @param key The key being searched for.
+	 * @return Iterator to the element with the given key, or end() if there is none.
+	 */
+	inline iterator find(const K& key) noexcept {
+		const iterator it = lowerBound(key);
+		return it != end() && !compare(key, it->first) ? it : end();
+	}
+
+	/**
+	 * @param key The key being searched for.
+	 * @return Iterator to the element with the given key, or end() if there is none.
+	 */
+	inline const_iterator find(const K& key) const noexcept {
+		const const_iterator it = lowerBound(key);
+		return it != end() && !compare(key, it->first) ? it : end();
+	}
+
+	/**
+	 * @param key The key being checked.
+	 * @return True if the map contains an element with the given key.
+	 */
+	inline bool contains(const K& key) const noexcept {
+		return find(key) != end();
+	}
+
+	/**
+	 * @param key The key being counted.
+	 * @return 1 if the map contains an element with the given key, 0 otherwise.
+	 */
+	inline size_t count(const K& key) const noexcept {
+		return contains(key) ? 1 : 0;
+	}
+
+	/**
+	 * @param key The key of the element. The element has to exist.
+	 * @return Reference to the value with the given key.
+	 */
+	inline V& at(const K& key) noexcept {
+		return find(key)->second;
+	}
+
+	/**
+	 * @param key The key of the element. The element has to exist.
+	 * @return Reference to the value with the given key.
+	 */
+	inline const V& at(const K& key) const noexcept {
+		return find(key)->second;
+	}
+
+	/**
+	 * @param key The key of the element.
+	 * @return Reference to the value with the given key, which is default constructed and inserted if it does not exist yet.
+	 */
+	inline V& operator [] (const K& key) noexcept {
+		return tryEmplace(key).first->second;
+	}
+
+	/**
+	 * @brief Inserts an element with the given key and value, unless an element with the key already exists.
+	 * @param key The key of the element.
+	 * @param args The arguments the value is constructed from.
+	 * @return Iterator to the element with the given key, and whether it was inserted.
+	 */
+	template<typename ...Args>
+	inline std::pair<iterator, bool> emplace(const K& key, Args&&... args) noexcept {
+		return tryEmplace(key, std::forward<Args>(args)...);
+	}
+
+	/**
+	 * @brief Removes the element with the given key.
+	 * @param key The key of the element being removed.
+	 * @return The number of removed elements.
+	 */
+	inline size_t erase(const K& key) noexcept {
+		const iterator it = find(key);
+		if(it == end()){
+			return 0;
+		}
+
+		elements.erase(it);
+		return 1;
+	}
+
+	/**
+	 * @brief Removes the element at the given position.
+	 * @param it Iterator to the element being removed.
+	 * @return Iterator to the element following the removed one.
+	 */
+	inline iterator erase(const_iterator it) noexcept {
+		return elements.erase(it);
+	}
+
+private:
+	std::vector<value_type> elements;
+	[[no_unique_address]] Compare compare = Compare();
+
+private:
+	inline iterator lowerBound(const K& key) noexcept {
+		return std::lower_bound(elements.begin(), elements.end(), key, [this](const value_type& element, const K& key){
+			return compare(element.first, key);
+		});
+	}
+
+	inline const_iterator lowerBound(const K& key) const noexcept {
+		return std::lower_bound(elements.begin(), elements.end(), key, [this](const value_type& element, const K& key){
+			return compare(element.first, key);
+		});
+	}
+
+	template<typename ...Args>
+	inline std::pair<iterator, bool> tryEmplace(const K& key, Args&&... args) noexcept {
+		const iterator it = lowerBound(key);
+		if(it != end() && !compare(key, it->first)){
+			return { it, false };
+		}
+
+		return { elements.emplace(it, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...)), true };
+	}
+};
+
+/**
+ * @brief An associative container for small non-negative integer keys, such as pin or port numbers.
+ * Keys below DirectLimit index directly into a contiguous array which grows up to the largest such key in use,
+ * other keys are kept in a FlatMap. Lookups of direct keys are a single bounds check and array access.
+ * @tparam V The type of values.
+ * @tparam DirectLimit Keys from 0 up to this limit are indexed directly.
+ */
+template<typename V, int DirectLimit = 64>
+class SmallIntMap {
+public:
+	/**
+	 * @return The number of elements in the map.
+	 */
+	inline size_t size() const noexcept {
+		return directCount + others.size();
+	}
+
+	/**
+	 * @return True if the map holds no elements, false otherwise.
+	 */
+	inline bool empty() const noexcept {
+		return size() == 0;
+	}
+
+	/**
+	 * @brief Removes all elements from the map.
+	 */
+	inline void clear() noexcept {
+		direct.clear();
+		directCount = 0;
+		others.clear();
+	}
+
+	/**
+	 * @param key The key being checked.
+	 * @return True if the map contains an element with the given key.
+	 */
+	inline bool contains(int key) const noexcept {
+		if(isDirect(key)){
+			return (size_t) key < direct.size() && direct[key].has_value();
+		}
+
+		return others.contains(key);
+	}
+
+	/**
+	 * @param key The key being counted.
+	 * @return 1 if the map contains an element with the given key, 0 otherwise.
+	 */
+	inline size_t count(int key) const noexcept {
+		return contains(key) ? 1 : 0;
+	}
+
+	/**
+	 * @param key The key of the element. The element has to exist.
+	 * @return Reference to the value with the given key.
+	 */
+	inline V& at(int key) noexcept {
+		return isDirect(key) ? *direct[key] : others.at(key);
+	}
+
+	/**
+	 * @param key The key of the element. The element has to exist.
+	 * @return Reference to the value with the given key.
+	 */
+	inline const V& at(int key) const noexcept {
+		return isDirect(key) ? *direct[key] : others.at(key);
+	}
+
+	/**
+	 * @param key The key of the element.
+	 * @return Reference to the value with the given key, which is default constructed and inserted if it does not exist yet.
+	 */
+	inline V& operator [] (int key) noexcept {
+		if(!isDirect(key)){
+			return others[key];
+		}
+
+		if((size_t) key >= direct.size()){
+			direct.resize(key + 1);
+		}
+
+		if(!direct[key].has_value()){
+			direct[key].emplace();
+			++directCount;
+		}
+
+		return *direct[key];
+	}
+
+	/**
+	 * @brief Removes the element with the given key.
+	 * @param key The key of the element being removed.
+	 * @return The number of removed elements.
+	 */
+	inline size_t erase(int key) noexcept {
+		if(!isDirect(key)){
+			return others.erase(key);
+		}
+
+		if((size_t) key >= direct.size() || !direct[key].has_value()){
+			return 0;
+		}
+
+		direct[key].reset();
+		--directCount;
+
+		return 1;
+	}
+
+	/**
+	 * @brief Calls the given function for each element in the map, in order of keys.
+	 * @param function The function, called with the key and a reference to the value.
+	 */
+	template<typename F>
+	inline void forEach(F&& function) noexcept {
+		auto it = others.begin();
+		for(; it != others.end() && it->first < 0; ++it){
+			function(it->first, it->second);
+		}
+
+		for(size_t key = 0; key < direct.size(); ++key){
+			if(direct[key].has_value()){
+				function((int) key, *direct[key]);
+			}
+		}
+
+		for(; it != others.end(); ++it){
+			function(it->first, it->second);
+		}
+	}
+
+private:
+	std::vector<std::optional<V>> direct;
+	size_t directCount = 0;
+	FlatMap<int, V> others;
+
+private:
+	static inline constexpr bool isDirect(int key) noexcept {
+		return key >= 0 && key < DirectLimit;
+	}
+};
+
+#endif //CMF_FLATMAP_H
@@ -0,0 +1,101 @@
+#ifndef CMF_INLINEALLOCATOR_H
+#define CMF_INLINEALLOCATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+/**
+ * @brief An allocator which holds storage for N elements inside itself, so containers using it need no heap allocation
+ * as long as they fit in it. Only one allocation can be served from the inline storage at a time.
+ * Allocations which do not fit either fail, or are served from the heap if HeapFallback is set.
+ * The storage belongs to the allocator instance, so copies of the allocator start with their own empty storage.
+ * @tparam T The type of elements being allocated.
+ * @tparam N The number of elements in the inline storage.
+ * @tparam HeapFallback Whether allocations that do not fit into the inline storage are served from the heap.
+ */
+template<typename T, size_t N, bool HeapFallback = false>
+class InlineAllocator {
+public:
+	using value_type = T;
+	using is_always_equal = std::false_type;
+	using propagate_on_container_copy_assignment = std::false_type;
+	using propagate_on_container_move_assignment = std::false_type;
+	using propagate_on_container_swap = std::false_type;
+
+	/**
+	 * @brief The same allocator for another element type, with storage for N of those elements.
+	 */
+	template<typename U>
+	struct rebind {
+		using other = InlineAllocator<U, N, HeapFallback>;
+	};
+
+	/**
+	 * @brief Default empty constructor.
+	 */
+	inline InlineAllocator() noexcept = default;
+
+	/**
+	 * @brief Copy constructor, which does not take over the storage of the other allocator.
+	 */
+	inline InlineAllocator(const InlineAllocator&) noexcept {}
+
+	/**
+	 * @brief Copy assignment, which does not take over the storage of the other allocator.
+	 * @return Reference to this.
+	 */
+	inline InlineAllocator& operator = (const InlineAllocator&) noexcept {
+		return *this;
+	}
+
+	/**
+	 * @param count The number of elements being allocated.
+	 * @return Pointer to the allocated memory, or nullptr if the allocation could not be served.
+	 */
+	inline T* allocate(size_t count) noexcept {
+		if(!inUse && count <= N){
+			inUse = true;
+			return reinterpret_cast<T*>(storage);
+		}
+
+		if constexpr(HeapFallback){
+			return std::allocator<T>().allocate(count);
+		}
+
+		return nullptr;
+	}
+
+	/**
+	 * @param pointer Pointer to the memory being freed, previously returned by allocate.
+	 * @param count The number of elements the memory was allocated for.
+	 */
+	inline void deallocate(T* pointer, size_t count) noexcept {
+		if(pointer == nullptr){
+			return;
+		}
+
+		if(pointer == reinterpret_cast<T*>(storage)){
+			inUse = false;
+			return;
+		}
+
+		if constexpr(HeapFallback){
+			std::allocator<T>().deallocate(pointer, count);
+		}
+	}
+
+	/**
+	 * @return True only for the same instance, since each allocator has its own storage.
+	 */
+	inline bool operator == (const InlineAllocator& other) const noexcept {
+		return this == &other;
+	}
+
+private:
+	alignas(T) uint8_t storage[N * sizeof(T)];
+	bool inUse = false;
+};
+
+#endif //CMF_INLINEALLOCATOR_H
@@ -0,0 +1,369 @@
+#ifndef CMF_INTRUSIVEQUEUE_H
+#define CMF_INTRUSIVEQUEUE_H
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <span>
+
+template<typename T, size_t Lanes>
+class IntrusiveQueue;
+
+/**
+ * @brief Base class of elements which can be queued in an IntrusiveQueue. Holds the links of the element inside the queue,
+ * so an element can be in at most one queue at a time, and is removed from it automatically when destroyed.
+ * @tparam T The type of the element deriving from this class.
+ * @tparam Lanes The number of lanes of the queues the element is used in.
+ */
+template<typename T, size_t Lanes = 1>
+class IntrusiveQueueNode {
+public:
+	/**
+	 * @brief Default empty constructor.
+	 */
+	inline IntrusiveQueueNode() noexcept = default;
+
+	/**
+	 * @brief Copy constructor, the copy is not queued anywhere.
+	 */
+	inline IntrusiveQueueNode(const IntrusiveQueueNode&) noexcept {}
+
+	/**
+	 * @brief Copy assignment, leaves the queue membership of both elements unchanged.
+	 * @return Reference to this.
+	 */
+	inline IntrusiveQueueNode& operator = (const IntrusiveQueueNode&) noexcept {
+		return *this;
+	}
+
+	/**
+	 * @brief Removes the element from the queue it is in.
+	 */
+	inline ~IntrusiveQueueNode() noexcept {
+		if(IntrusiveQueue<T, Lanes>* owningQueue = queue.load(std::memory_order_acquire)){
+			owningQueue->removeNode(this);
+		}
+	}
+
+private:
+	friend class IntrusiveQueue<T, Lanes>;
+
+	IntrusiveQueueNode* previous = nullptr;
+	IntrusiveQueueNode* next = nullptr;
+	size_t lane = 0;
+	std::atomic<IntrusiveQueue<T, Lanes>*> queue = nullptr;
+};
+
+/**
+ * @brief A thread-safe queue of element pointers, which stores its links inside the elements themselves.
+ * Pushing an element which is already queued is ignored, and removal and membership checks are O(1), without any memory allocation.
+ * Elements are pushed into one of several FIFO lanes, and popped from the highest non-empty lane first.
+ * To avoid starvation, an element waiting in a lower lane is popped next once the given number of elements of higher lanes were popped before it.
+ * Offers the same blocking wait semantics as Queue.
+ * @tparam T The type of elements, has to derive from IntrusiveQueueNode<T, Lanes>.
+ * @tparam Lanes The number of lanes, elements of lanes with higher indices are popped first.
+ */
+template<typename T, size_t Lanes = 1>
+class IntrusiveQueue {
+public:
+	/**
+	 * @brief Default constructor.
+	 * @param starvationLimit The number of elements popped from higher lanes before an element waiting in a lower lane is popped.
+	 * 0 means lower lanes wait until all higher lanes are empty.
+	 */
+	inline explicit IntrusiveQueue(size_t starvationLimit = 0) noexcept : starvationLimit(starvationLimit), waitSemaphore(xSemaphoreCreateBinaryStatic(&waitSemaphoreBuffer)) {}
+
+	/**
+	 * @brief Deleted copy constructor, since elements can only be in one queue.
+	 */
+	IntrusiveQueue(const IntrusiveQueue&) = delete;
+
+	/**
+	 * @brief Deleted copy assignment.
+	 */
+	IntrusiveQueue& operator = (const IntrusiveQueue&) = delete;
+
+	/**
+	 * @brief Unblocks waiting threads and removes all elements from the queue.
+	 */
+	inline ~IntrusiveQueue() noexcept {
+		setKillPill();
+		clear();
+		vSemaphoreDelete(waitSemaphore);
+	}
+
+	/**
+	 * @return The number of queued elements. Can be called without locking, while other threads push and pop.
+	 */
+	inline size_t size() const noexcept {
+		return count.load(std::memory_order_acquire);
+	}
+
+	/**
+	 * @brief Checker for an empty queue.
+	 * @return True if size is 0. False otherwise.
+	 */
+	inline bool empty() const noexcept {
+		return size() == 0;
+	}
+
+	/**
+	 * @brief Adds an element at the end of a lane, unless it is already queued.
+	 * @param element The element being added.
+	 * @param lane The lane the element is added to. Lanes past the last one are clamped to it.
+	 * @return True if the element was added, false if it is nullptr or already in this or another queue.
+	 */
+	inline bool push(T* element, size_t lane = 0) noexcept {
+		if(element == nullptr){
+			return false;
+		}
+
+		Node* node = element;
+
+		std::lock_guard guard(accessMutex);
+
+		IntrusiveQueue* expected = nullptr;
+		if(!node->queue.compare_exchange_strong(expected, this, std::memory_order_acq_rel)){
+			return false;
+		}
+
+		lane = std::min(lane, Lanes - 1);
+
+		node->lane = lane;
+		node->previous = last[lane];
+		node->next = nullptr;
+
+		if(last[lane] != nullptr){
+			last[lane]->next = node;
+		}else{
+			first[lane] = node;
+		}
+
+		last[lane] = node;
+		count.fetch_add(1, std::memory_order_release);
+
+		xSemaphoreGive(waitSemaphore);
+
+		return true;
+	}
+
+	/**
+	 * @brief Checks if an element is in this queue.
+	 * @param element The element being checked.
+	 * @return True if the queue contains the given element.
+	 */
+	inline bool check(const T* element) const noexcept {
+		if(element == nullptr){
+			return false;
+		}
+
+		const Node* node = element;
+		return node->queue.load(std::memory_order_acquire) == this;
+	}
+
+	/**
+	 * @brief Removes an element from the queue no matter its location.
+	 * @param element The element being removed.
+	 * @return True if the element was in this queue, false otherwise.
+	 */
+	inline bool remove(T* element) noexcept {
+		if(element == nullptr){
+			return false;
+		}
+
+		return removeNode(element);
+	}
+
+	/**
+	 * @param value The variable set to the next element in order of lanes, which is removed from the queue.
+	 * @param wait The maximum wait time for an element to be available.
+	 * @return True if successful, false otherwise.
+	 */
+	inline bool pop(T*& value, TickType_t wait = portMAX_DELAY) noexcept {
+		return popN(std::span<T*>(&value, 1), wait) == 1;
+	}
+
+	/**
+	 * @brief Removes up to values.size() elements from the front of the queue under a single lock, waiting only for the first one.
+	 * @param values The span the removed elements are written into, in the order they are popped.
+	 * @param wait The maximum wait time for at least one element to be available.
+	 * @return The number of elements removed.
+	 */
+	inline size_t popN(std::span<T*> values, TickType_t wait = portMAX_DELAY) noexcept {
+		if(values.empty()){
+			return 0;
+		}
+
+		if(xSemaphoreTake(waitSemaphore, wait) != pdTRUE){
+			return 0;
+		}
+
+		std::lock_guard guard(accessMutex);
+
+		if(kill){
+			return 0;
+		}
+
+		size_t popped = 0;
+		for(; popped < values.size() && !empty(); ++popped){
+			Node* node = first[nextLane()];
+			unlink(node);
+			values[popped] = static_cast<T*>(node);
+		}
+
+		if(!empty()){
+			xSemaphoreGive(waitSemaphore);
+		}
+
+		return popped;
+	}
+
+	/**
+	 * @brief Waits until an element is available, without removing it.
+	 * @param wait The maximum wait time for an element to be available.
+	 * @return True if an element is available, false on timeout or kill pill. Another thread may still pop it first.
+	 */
+	inline bool waitForElement(TickType_t wait = portMAX_DELAY) noexcept {
+		if(xSemaphoreTake(waitSemaphore, wait) != pdTRUE){
+			return false;
+		}
+
+		std::lock_guard guard(accessMutex);
+
+		if(kill){
+			return false;
+		}
+
+		// Handed on to the pop which follows
+		xSemaphoreGive(waitSemaphore);
+
+		return true;
+	}
+
+	/**
+	 * @brief Removes all elements from the queue, leaving it empty.
+	 */
+	inline void clear() noexcept {
+		std::lock_guard guard(accessMutex);
+
+		for(size_t lane = 0; lane < Lanes; ++lane){
+			while(first[lane] != nullptr){
+				unlink(first[lane]);
+			}
+		}
+
+		xSemaphoreTake(waitSemaphore, 0);
+	}
+
+	/**
+	 * @brief Unblocks all thread-safe functionality with a kill pill, meaning all retrieval attempts will fail, but will unblock threads waiting on it.
+	 * @param value The value being set to the kill pill.
+	 */
+	inline void setKillPill(bool value = true) noexcept {
+		std::lock_guard guard(accessMutex);
+		kill = value;
+
+		if(kill){
+			xSemaphoreGive(waitSemaphore);
+		}
+	}
+
+private:
+	using Node = IntrusiveQueueNode<T, Lanes>;
+	friend Node;
+
+	Node* first[Lanes] = { nullptr };
+	Node* last[Lanes] = { nullptr };
+	size_t skipped[Lanes] = { 0 }; // Number of elements popped from higher lanes while the lane was waiting
+	std::atomic_size_t count = 0; // Changed under the access mutex, atomic so the size can be read without it
+	const size_t starvationLimit;
+	bool kill = false;
+	std::mutex accessMutex;
+	StaticSemaphore_t waitSemaphoreBuffer;
+	SemaphoreHandle_t waitSemaphore;
+
+private:
+	/**
+	 * @param node The node being removed.
+	 * @return True if the node was in this queue, false otherwise.
+	 */
+	inline bool removeNode(Node* node) noexcept {
+		std::lock_guard guard(accessMutex);
+
+		if(node->queue.load(std::memory_order_acquire) != this){
+			return false;
+		}
+
+		unlink(node);
+
+		if(empty()){
+			xSemaphoreTake(waitSemaphore, 0);
+		}
+
+		return true;
+	}
+
+	/**
+	 * @brief Unlinks a node which is in this queue. Has to be called with the access mutex locked.
+	 * @param node The node being unlinked.
+	 */
+	inline void unlink(Node* node) noexcept {
+		const size_t lane = node->lane;
+
+		if(node->previous != nullptr){
+			node->previous->next = node->next;
+		}else{
+			first[lane] = node->next;
+		}
+
+		if(node->next != nullptr){
+			node->next->previous = node->previous;
+		}else{
+			last[lane] = node->previous;
+		}
+
+		if(first[lane] == nullptr){
+			skipped[lane] = 0;
+		}
+
+		node->previous = node->next = nullptr;
+		node->queue.store(nullptr, std::memory_order_release);
+		count.fetch_sub(1, std::memory_order_release);
+	}
+
+	/**
+	 * @brief Selects the lane the next element is popped from, and updates the starvation counters of the lanes below it.
+	 * Has to be called with the access mutex locked on a non-empty queue.
+	 * @return The index of the selected lane.
+	 */
+	inline size_t nextLane() noexcept {
+		size_t selected = Lanes - 1;
+		while(first[selected] == nullptr){
+			--selected;
+		}
+
+		if(starvationLimit > 0){
+			for(size_t lane = selected; lane-- > 0; ){
+				if(first[lane] != nullptr && skipped[lane] >= starvationLimit){
+					selected = lane;
+					break;
+				}
+			}
+		}
+
+		skipped[selected] = 0;
+
+		for(size_t lane = 0; lane < selected; ++lane){
+			if(first[lane] != nullptr){
+				++skipped[lane];
+			}
+		}
+
+		return selected;
+	}
+};
+
+#endif //CMF_INTRUSIVEQUEUE_H
@@ -0,0 +1,200 @@
+#ifndef CMF_LATESTVALUE_H
+#define CMF_LATESTVALUE_H
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <utility>
+
+/**
+ * @brief A thread-safe single slot holding only the most recent value pushed into it.
+ * Pushing while a value is pending replaces it, and the replaced value is counted as dropped.
+ * Used in place of a queue when only the newest value matters, since memory use and the work of the consumer stay constant regardless of the push rate.
+ * Offers the same blocking wait semantics as Queue.
+ * @tparam T The type of value being held.
+ */
+template<typename T>
+class LatestValue {
+public:
+	/**
+	 * @brief Default constructor of an empty slot.
+	 */
+	inline LatestValue() noexcept : waitSemaphore(xSemaphoreCreateBinaryStatic(&waitSemaphoreBuffer)) {}
+
+	/**
+	 * @brief Deleted copy constructor, since the wait semaphore can not be shared.
+	 */
+	LatestValue(const LatestValue&) = delete;
+
+	/**
+	 * @brief Deleted copy assignment.
+	 */
+	LatestValue& operator = (const LatestValue&) = delete;
+
+	/**
+	 * @brief Unblocks waiting threads and destroys the pending value.
+	 */
+	inline ~LatestValue() noexcept {
+		setKillPill();
+
+		std::lock_guard guard(accessMutex);
+		value.reset();
+
+		vSemaphoreDelete(waitSemaphore);
+	}
+
+	/**
+	 * @return The number of pending values, 0 or 1.
+	 */
+	inline size_t size() const noexcept {
+		return empty() ? 0 : 1;
+	}
+
+	/**
+	 * @brief Checker for an empty slot.
+	 * @return True if no value is pending. False otherwise.
+	 */
+	inline bool empty() const noexcept {
+		return !pending.load(std::memory_order_acquire);
+	}
+
+	/**
+	 * @return The number of values replaced by a newer one before they were popped.
+	 */
+	inline size_t getDropped() const noexcept {
+		return dropped.load(std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief Stores a value into the slot, replacing the pending one if there is any.
+	 * @param newValue The value being stored.
+	 * @return True if the slot was empty before, false if a pending value was replaced.
+	 */
+	inline bool store(T&& newValue) noexcept {
+		std::lock_guard guard(accessMutex);
+
+		const bool wasEmpty = !value.has_value();
+		if(!wasEmpty){
+			dropped.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		value = std::move(newValue);
+		pending.store(true, std::memory_order_release);
+
+		if(wasEmpty){
+			xSemaphoreGive(waitSemaphore);
+		}
+
+		return wasEmpty;
+	}
+
+	/**
+	 * @brief Push function with the interface of a queue. Never fails, since a pending value is replaced.
+	 * @param newValue The value being stored.
+	 * @return Always true.
+	 */
+	inline bool push(const T& newValue) noexcept {
+		store(T(newValue));
+		return true;
+	}
+
+	/**
+	 * @brief Push function with the interface of a queue. Never fails, since a pending value is replaced.
+	 * @param newValue The value being stored.
+	 * @return Always true.
+	 */
+	inline bool push(T&& newValue) noexcept {
+		store(std::move(newValue));
+		return true;
+	}
+
+	/**
+	 * @brief Retrieves the pending value without removing it.
+	 * @param result The variable that is set to the pending value.
+	 * @param wait The maximum time to halt thread execution and wait for a value.
+	 * @return True if successful, false otherwise.
+	 */
+	inline bool front(T& result, TickType_t wait = portMAX_DELAY) noexcept {
+		if(xSemaphoreTake(waitSemaphore, wait) != pdTRUE){
+			return false;
+		}
+
+		std::lock_guard guard(accessMutex);
+
+		if(kill || !value.has_value()){
+			return false;
+		}
+
+		result = *value;
+
+		xSemaphoreGive(waitSemaphore);
+
+		return true;
+	}
+
+	/**
+	 * @brief Pops the pending value.
+	 * @param result The variable the pending value is moved into.
+	 * @param wait The maximum time to halt thread execution and wait for a value.
+	 * @return True if successful, false otherwise.
+	 */
+	inline bool pop(T& result, TickType_t wait = portMAX_DELAY) noexcept {
+		return popN(std::span<T>(&result, 1), wait) == 1;
+	}
+
+	/**
+	 * @brief Pops the pending value with the interface of a queue.
+	 * @param values The span the pending value is moved into, as its first element.
+	 * @param wait The maximum time to halt thread execution and wait for a value.
+	 * @return The number of values popped, 0 or 1.
+	 */
+	inline size_t popN(std::span<T> values, TickType_t wait = portMAX_DELAY) noexcept {
+		if(values.empty()){
+			return 0;
+		}
+
+		if(xSemaphoreTake(waitSemaphore, wait) != pdTRUE){
+			return 0;
+		}
+
+		std::lock_guard guard(accessMutex);
+
+		if(kill || !value.has_value()){
+			return 0;
+		}
+
+		values[0] = std::move(*value);
+		value.reset();
+		pending.store(false, std::memory_order_release);
+
+		return 1;
+	}
+
+	/**
+	 * @brief Unblocks all thread-safe functionality with a kill pill, meaning all data retrieval attempts will fail, but will unblock threads waiting on it.
+	 * @param killValue The value being set to the kill pill.
+	 */
+	inline void setKillPill(bool killValue = true) noexcept {
+		std::lock_guard guard(accessMutex);
+		kill = killValue;
+
+		if(kill){
+			xSemaphoreGive(waitSemaphore);
+		}
+	}
+
+private:
+	std::optional<T> value;
+	std::atomic_bool pending = false;
+	std::atomic_size_t dropped = 0;
+	bool kill = false;
+	std::mutex accessMutex;
+	StaticSemaphore_t waitSemaphoreBuffer;
+	SemaphoreHandle_t waitSemaphore;
+};
+
+#endif //CMF_LATESTVALUE_H
@@ -0,0 +1,420 @@
+#ifndef CMF_MPSCQUEUE_H
+#define CMF_MPSCQUEUE_H
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <atomic>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief A fixed capacity queue which any number of producer threads can push into without locking, read by a single consumer thread.
+ * Producers reserve a slot by advancing the tail with a compare-and-swap and publish the element through the sequence number of its slot,
+ * so a producer never waits for another one. Offers the same blocking wait semantics as Queue, the waiting consumer is woken up with a task notification
+ * instead of a semaphore. Since the consumer sleeps on the notification of its own task, it should not be used together with other notification based waiting in that task.
+ * @tparam T The type of data being held in the queue.
+ * @tparam Allocator The type of allocator used for the buffer of the queue, rebound to its slots.
+ */
+template<typename T, typename Allocator = std::allocator<T>>
+class MPSCQueue {
+public:
+	/**
+	 * @brief The constructor with capacity option.
+	 * @param size The maximum number of elements the queue can hold. The queue does not resize.
+	 */
+	inline explicit MPSCQueue(size_t size = DefaultSize) noexcept : bufferSize(size > 0 ? size : 1) {
+		buffer = allocator.allocate(bufferSize);
+		if(buffer == nullptr){
+			bufferSize = 0;
+			return;
+		}
+
+		for(size_t i = 0; i < bufferSize; ++i){
+			new(&buffer[i]) Cell();
+			buffer[i].sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	/**
+	 * @brief Deleted copy constructor, since copying can not be done safely while both sides are active.
+	 */
+	MPSCQueue(const MPSCQueue&) = delete;
+
+	/**
+	 * @brief Deleted copy assignment.
+	 */
+	MPSCQueue& operator = (const MPSCQueue&) = delete;
+
+	/**
+	 * @brief Unblocks the waiting consumer, destroys the remaining elements and frees memory.
+	 */
+	inline ~MPSCQueue() noexcept {
+		setKillPill();
+		clear();
+
+		if(buffer != nullptr){
+			for(size_t i = 0; i < bufferSize; ++i){
+				buffer[i].~Cell();
+			}
+
+			allocator.deallocate(buffer, bufferSize);
+			buffer = nullptr;
+		}
+	}
+
+	/**
+	 * @return The size of the queue, including elements which are still being pushed.
+	 */
+	inline size_t size() const noexcept {
+		// The head is read first, so the tail read afterwards can not be behind it
+		const size_t first = head.load(std::memory_order_acquire);
+		return tail.load(std::memory_order_acquire) - first;
+	}
+
+	/**
+	 * @return The capacity of the queue.
+	 */
+	inline size_t capacity() const noexcept {
+		return bufferSize;
+	}
+
+	/**
+	 * @brief Checker for an empty queue.
+	 * @return True if size is 0. False otherwise.
+	 */
+	inline bool empty() const noexcept {
+		return size() == 0;
+	}
+
+	/**
+	 * @brief Checker for a full queue.
+	 * @return True if size equals capacity. False otherwise.
+	 */
+	inline bool full() const noexcept {
+		return size() >= bufferSize;
+	}
+
+	/**
+	 * @brief Retrieves the front value without removing it. Can only be called from the consumer thread.
+	 * @param value The variable that is set to the front value.
+	 * @param wait The maximum time to halt thread execution and wait to retrieve a value.
+	 * @return True if successful, false otherwise.
+	 */
+	inline bool front(T& value, TickType_t wait = portMAX_DELAY) noexcept {
+		if(!waitForData(wait)){
+			return false;
+		}
+
+		value = *buffer[head.load(std::memory_order_relaxed) % bufferSize].element();
+
+		return true;
+	}
+
+	/**
+	 * @brief Pop function which retrieves a value from the internal buffer before removing it internally. Can only be called from the consumer thread.
+	 * @param value The value variable set to the value at the front of the queue before removing it.
+	 * @param wait The maximum wait time for a successful value pop before abort.
+	 * @return True if successful, false otherwise.
+	 */
+	inline bool pop(T& value, TickType_t wait = portMAX_DELAY) noexcept {
+		if(!waitForData(wait)){
+			return false;
+		}
+
+		const size_t index = head.load(std::memory_order_relaxed);
+		value = take(index);
+		head.store(index + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	/**
+	 * @brief Pops up to values.size() values from the front of the queue, waiting only for the first one. Can only be called from the consumer thread.
+	 * Stops at the first element which is still being pushed, so the values are always returned in queue order.
+	 * @param values The span the popped values are moved into, in queue order.
+	 * @param wait The maximum wait time for at least one value to be available.
+	 * @return The number of values popped.
+	 */
+	inline size_t popN(std::span<T> values, TickType_t wait = portMAX_DELAY) noexcept {
+		if(values.empty() || !waitForData(wait)){
+			return 0;
+		}
+
+		const size_t first = head.load(std::memory_order_relaxed);
+		size_t count = 0;
+
+		while(count < values.size() && published(first + count)){
+			values[count] = take(first + count);
+			++count;
+		}
+
+		head.store(first + count, std::memory_order_release);
+
+		return count;
+	}
+
+	/**
+	 * @brief Pops all values currently in the queue, waiting only for the first one. Can only be called from the consumer thread.
+	 * Stops at the first element which is still being pushed, so the values are always returned in queue order.
+	 * @param values The vector the popped values are appended to, in queue order.
+	 * @param wait The maximum wait time for at least one value to be available.
+	 * @return The number of values popped.
+	 */
+	inline size_t popAll(std::vector<T>& values, TickType_t wait = portMAX_DELAY) noexcept {
+		if(!waitForData(wait)){
+			return 0;
+		}
+
+		const size_t first = head.load(std::memory_order_relaxed);
+		size_t count = 0;
+
+		values.reserve(values.size() + size());
+		while(published(first + count)){
+			values.emplace_back(take(first + count));
+			++count;
+		}
+
+		head.store(first + count, std::memory_order_release);
+
+		return count;
+	}
+
+	/**
+	 * @brief Pushes as many of the given values as fit at the end of the queue, with a single wake-up of the consumer.
+	 * The values are kept together, pushes from other producers do not end up between them.
+	 * @param values The values being added to the queue.
+	 * @return The number of values pushed.
+	 */
+	inline size_t pushN(std::span<const T> values) noexcept {
+		size_t first = tail.load(std::memory_order_relaxed);
+		size_t count;
+
+		do {
+			count = std::min(values.size(), room(first, bufferSize));
+			if(count == 0){
+				return 0;
+			}
+		} while(!tail.compare_exchange_weak(first, first + count, std::memory_order_relaxed, std::memory_order_relaxed));
+
+		for(size_t i = 0; i < count; ++i){
+			publish(first + i, values[i]);
+		}
+
+		notify();
+
+		return count;
+	}
+
+	/**
+	 * @brief Push function which adds a value at the end of the queue.
+	 * @param value The value being added to the queue.
+	 * @return True if successful, false if the queue is full.
+	 */
+	inline bool push(const T& value) noexcept {
+		return pushInternal(value, bufferSize);
+	}
+
+	/**
+	 * @brief A move push function. The given value is moved to the queue and emptied / invalidated.
+	 * @param value The value being added to the queue.
+	 * @return True if successful, false if the queue is full.
+	 */
+	inline bool push(T&& value) noexcept {
+		return pushInternal(std::move(value), bufferSize);
+	}
+
+	/**
+	 * @brief Adds a value at the end of the queue only if the queue holds fewer than limit elements.
+	 * The check and the push are a single step, so concurrent producers can not push the queue past the limit.
+	 * @param value The value being added to the queue. Left untouched if the push fails.
+	 * @param limit The maximum number of elements the queue may hold, capped at its capacity.
+	 * @return True if successful, false if the queue holds limit elements or more.
+	 */
+	inline bool pushBounded(T&& value, size_t limit) noexcept {
+		return pushInternal(std::move(value), std::min(limit, bufferSize));
+	}
+
+	/**
+	 * @brief Removes all values from the queue, leaving it empty apart from values which are still being pushed. Can only be called from the consumer thread.
+	 */
+	inline void clear() noexcept {
+		size_t index = head.load(std::memory_order_relaxed);
+
+		for(; published(index); ++index){
+			Cell& cell = buffer[index % bufferSize];
+			cell.element()->~T();
+			cell.sequence.store(index + bufferSize, std::memory_order_release);
+		}
+
+		head.store(index, std::memory_order_release);
+	}
+
+	/**
+	 * @brief Unblocks the waiting consumer with a kill pill, meaning all data retrieval attempts will fail.
+	 * @param value The value being set to the kill pill.
+	 */
+	inline void setKillPill(bool value = true) noexcept {
+		kill.store(value, std::memory_order_release);
+
+		if(value){
+			notify();
+		}
+	}
+
+private:
+	/**
+	 * @brief A slot of the queue. Its sequence number equals the index the slot is free to be pushed to,
+	 * and is advanced by one once the element pushed to that index can be read.
+	 */
+	struct Cell {
+		std::atomic_size_t sequence = 0;
+		alignas(T) uint8_t storage[sizeof(T)];
+
+		inline T* element() noexcept { return reinterpret_cast<T*>(storage); }
+	};
+
+	using CellAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Cell>;
+
+	static constexpr size_t DefaultSize = CONFIG_CMF_EVENT_MPSC_QUEUE_SIZE;
+	Cell* buffer = nullptr;
+	CellAllocator allocator = CellAllocator();
+	size_t bufferSize;
+	std::atomic_size_t head = 0; // Index of the next element read, only changed by the consumer
+	std::atomic_size_t tail = 0; // Index of the next slot reserved, taken by producers with a compare-and-swap
+	std::atomic_bool kill = false;
+	std::atomic<TaskHandle_t> waitingTask = nullptr;
+
+private:
+	template<typename V>
+	inline bool pushInternal(V&& value, size_t limit) noexcept {
+		size_t index = tail.load(std::memory_order_relaxed);
+
+		do {
+			if(room(index, limit) == 0){
+				return false;
+			}
+		} while(!tail.compare_exchange_weak(index, index + 1, std::memory_order_relaxed, std::memory_order_relaxed));
+
+		publish(index, std::forward<V>(value));
+
+		notify();
+
+		return true;
+	}
+
+	/**
+	 * @param index The index of the first slot a producer is about to reserve.
+	 * @param limit The maximum number of elements the queue may hold.
+	 * @return The number of slots which can be reserved from the index on.
+	 * The consumer advances the head only after it is done with the slot, so every reserved slot is free to be written.
+	 */
+	inline size_t room(size_t index, size_t limit) const noexcept {
+		const size_t used = index - head.load(std::memory_order_acquire);
+		return used < limit ? limit - used : 0;
+	}
+
+	/**
+	 * @brief Constructs an element in a reserved slot and makes it visible to the consumer.
+	 * @param index The index the slot was reserved at.
+	 * @param value The value being added to the queue.
+	 */
+	template<typename V>
+	inline void publish(size_t index, V&& value) noexcept {
+		Cell& cell = buffer[index % bufferSize];
+		new(cell.storage) T(std::forward<V>(value));
+		cell.sequence.store(index + 1, std::memory_order_release);
+	}
+
+	/**
+	 * @param index The index of an element.
+	 * @return True if the element at the index was pushed completely and can be read.
+	 */
+	inline bool published(size_t index) const noexcept {
+		return buffer != nullptr && buffer[index % bufferSize].sequence.load(std::memory_order_acquire) == index + 1;
+	}
+
+	/**
+	 * @brief Moves a published element out of its slot and frees the slot for the next round through the buffer.
+	 * The head has to be advanced past the index afterwards.
+	 * @param index The index of the element.
+	 * @return The element.
+	 */
+	inline T take(size_t index) noexcept {
+		Cell& cell = buffer[index % bufferSize];
+		T value = std::move_if_noexcept(*cell.element());
+		cell.element()->~T();
+		cell.sequence.store(index + bufferSize, std::memory_order_release);
+
+		return value;
+	}
+
+	/**
+	 * @brief Wakes up the consumer if it is waiting for data.
+	 */
+	inline void notify() noexcept {
+		// Pairs with the fence in waitForData, so either the consumer sees the new data or the producer sees the waiting consumer
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		if(waitingTask.load(std::memory_order_relaxed) == nullptr){
+			return;
+		}
+
+		if(TaskHandle_t task = waitingTask.exchange(nullptr, std::memory_order_acq_rel)){
+			xTaskNotifyGive(task);
+		}
+	}
+
+	/**
+	 * @brief Waits until the element at the front of the queue is published, sleeping on the notification of the calling task.
+	 * A producer still pushing the front element wakes the consumer up once it is done.
+	 * @param wait The maximum wait time.
+	 * @return True if there is data in the queue, false on timeout or kill pill.
+	 */
+	inline bool waitForData(TickType_t wait) noexcept {
+		if(kill.load(std::memory_order_acquire)){
+			return false;
+		}
+
+		if(published(head.load(std::memory_order_relaxed))){
+			return true;
+		}
+
+		if(wait == 0){
+			return false;
+		}
+
+		const TickType_t start = xTaskGetTickCount();
+
+		for(;;){
+			if(kill.load(std::memory_order_acquire)){
+				return false;
+			}
+
+			if(published(head.load(std::memory_order_relaxed))){
+				return true;
+			}
+
+			const TickType_t elapsed = xTaskGetTickCount() - start;
+			if(wait != portMAX_DELAY && elapsed >= wait){
+				return false;
+			}
+
+			waitingTask.store(xTaskGetCurrentTaskHandle(), std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			// Notifications left over from an earlier wake-up only cause another pass through the loop
+			if(!published(head.load(std::memory_order_relaxed)) && !kill.load(std::memory_order_acquire)){
+				ulTaskNotifyTake(pdTRUE, wait == portMAX_DELAY ? portMAX_DELAY : wait - elapsed);
+			}
+
+			waitingTask.store(nullptr, std::memory_order_relaxed);
+		}
+	}
+};
+
+#endif //CMF_MPSCQUEUE_H
@@ -3,11 +3,14 @@
 
 #include <freertos/FreeRTOS.h>
 #include <freertos/semphr.h>
+#include <algorithm>
 #include <cstddef>
 #include <cstring>
 #include <memory>
 #include <mutex>
+#include <span>
 #include <vector>
+#include "InlineAllocator.h"
 
 /**
  * @brief A variable size queue which is thread-safe, template,
@@ -22,7 +25,7 @@ public:
 	 * @brief The constructor with starting size option,
 	 * @param size The size the queue starts its life with.
 	 */
-	inline explicit Queue(size_t size = DefaultSize) noexcept : bufferSize(size), waitSemaphore(xSemaphoreCreateBinary()) {
+	inline explicit Queue(size_t size = DefaultSize) noexcept : bufferSize(size), waitSemaphore(xSemaphoreCreateBinaryStatic(&waitSemaphoreBuffer)) {
 		reserve(bufferSize);
 	}
 
@@ -30,7 +33,7 @@ public:
 	 * @brief The copy constructor from another queue of same data type.
 	 * @param other The queue being copied.
 	 */
-	inline Queue(const Queue& other) noexcept : bufferSize(other.bufferSize), begin(other.begin), end(other.end), qSize(other.qSize), waitSemaphore(xSemaphoreCreateBinary()) {
+	inline Queue(const Queue& other) noexcept : bufferSize(other.bufferSize), begin(other.begin), end(other.end), qSize(other.qSize), waitSemaphore(xSemaphoreCreateBinaryStatic(&waitSemaphoreBuffer)) {
 		std::lock_guard lock(other.accessMutex);
 
 		reserve(bufferSize);
@@ -60,10 +63,26 @@ public:
 	 * @brief The move constructor from another queue with the same data type.
 	 * @param other The queue being moved. The queue is empty after the constructor finishes execution.
 	 */
-	inline Queue(Queue&& other) noexcept : buffer(other.buffer), bufferSize(other.bufferSize), begin(other.begin), end(other.end), qSize(other.qSize), waitSemaphore(xSemaphoreCreateBinary()) {
+	inline Queue(Queue&& other) noexcept : bufferSize(other.bufferSize), begin(other.begin), end(other.end), qSize(other.qSize), waitSemaphore(xSemaphoreCreateBinaryStatic(&waitSemaphoreBuffer)) {
 		std::lock_guard lock(other.accessMutex);
-		other.buffer = nullptr;
-		other.bufferSize = 0;
+
+		if constexpr(std::allocator_traits<Allocator>::is_always_equal::value){
+			buffer = other.buffer;
+			other.buffer = nullptr;
+			other.bufferSize = 0;
+		}else{
+			// Memory of allocators with their own storage can not be taken over, so the elements are moved instead
+			reserveInternal(bufferSize);
+
+			for(size_t i = 0; i < qSize; ++i){
+				const size_t index = (begin + i) % bufferSize;
+				new(&buffer[index]) T(std::move_if_noexcept(other.buffer[index]));
+				other.buffer[index].~T();
+			}
+
+			xSemaphoreTake(other.waitSemaphore, 0);
+		}
+
 		other.begin = other.end = 0;
 		other.qSize = 0;
 
@@ -179,18 +198,106 @@ public:
 		}
 
 		value = std::move_if_noexcept(buffer[begin]);
-		buffer[begin].~T();
+		popFrontInternal();
 
-		--qSize;
 		if(!empty()){
-			begin = (begin + 1) % bufferSize;
+			xSemaphoreGive(waitSemaphore);
+		}
+
+		return true;
+	}
+
+	/**
+	 * @brief Pops up to values.size() values from the front of the queue under a single lock, waiting only for the first one.
+	 * @param values The span the popped values are moved into, in queue order.
+	 * @param wait The maximum wait time for at least one value to be available.
+	 * @return The number of values popped.
+	 */
+	inline size_t popN(std::span<T> values, TickType_t wait = portMAX_DELAY) noexcept {
+		if(values.empty()){
+			return 0;
+		}
+
+		if(xSemaphoreTake(waitSemaphore, wait) != pdTRUE){
+			return 0;
+		}
+
+		std::lock_guard guard(accessMutex);
+
+		if(kill){
+			return 0;
+		}
+
+		const size_t count = std::min(values.size(), qSize);
+		for(size_t i = 0; i < count; ++i){
+			values[i] = std::move_if_noexcept(buffer[begin]);
+			popFrontInternal();
 		}
 
 		if(!empty()){
 			xSemaphoreGive(waitSemaphore);
 		}
 
-		return true;
+		return count;
+	}
+
+	/**
+	 * @brief Pops all values currently in the queue under a single lock, waiting only for the first one.
+	 * @param values The vector the popped values are appended to, in queue order.
+	 * @param wait The maximum wait time for at least one value to be available.
+	 * @return The number of values popped.
+	 */
+	inline size_t popAll(std::vector<T>& values, TickType_t wait = portMAX_DELAY) noexcept {
+		if(xSemaphoreTake(waitSemaphore, wait) != pdTRUE){
+			return 0;
+		}
+
+		std::lock_guard guard(accessMutex);
+
+		if(kill){
+			return 0;
+		}
+
+		const size_t count = qSize;
+		values.reserve(values.size() + count);
+		for(size_t i = 0; i < count; ++i){
+			values.emplace_back(std::move_if_noexcept(buffer[begin]));
+			popFrontInternal();
+		}
+
+		return count;
+	}
+
+	/**
+	 * @brief Pushes all given values at the end of the queue under a single lock, with a single wake-up of the waiting thread.
+	 * The queue is resized at most once to fit all values.
+	 * @param values The values being added to the queue.
+	 * @return The number of values pushed, either all of them or 0 if the queue could not be resized.
+	 */
+	inline size_t pushN(std::span<const T> values) noexcept {
+		if(values.empty()){
+			return 0;
+		}
+
+		std::lock_guard guard(accessMutex);
+
+		if(qSize + values.size() > bufferSize && !reserveInternal(std::max(bufferSize * 2, qSize + values.size()))){
+			return 0;
+		}
+
+		for(const T& value : values){
+			if(!empty()){
+				end = (end + 1) % bufferSize;
+			}
+
+			new(&buffer[end]) T(value);
+
+			++qSize;
+		}
+
+		xSemaphoreGive(waitSemaphore);
+
+		return values.size();
 	}
 
 	/**
@@ -243,6 +350,49 @@ public:
 		return true;
 	}
 
+	/**
+	 * @brief Pushes a value unless the queue already holds the given number of values. The buffer grows as needed, but never past the limit.
+	 * @param value The value being added to the queue.
+	 * @param limit The maximum number of values held by the queue.
+	 * @return True if successful, false if the queue is at the limit or could not be resized.
+	 */
+	inline bool pushBounded(T&& value, size_t limit) noexcept {
+		std::lock_guard guard(accessMutex);
+
+		if(qSize >= limit){
+			return false;
+		}
+
+		if(full() && !reserveInternal(std::min(bufferSize * 2, limit))){
+			return false;
+		}
+
+		pushInternal(std::move(value));
+
+		return true;
+	}
+
+	/**
+	 * @brief Pushes a value, removing the oldest value first if the queue already holds the given number of values.
+	 * The buffer grows as needed, but never past the limit. The value is always pushed.
+	 * @param value The value being added to the queue.
+	 * @param limit The maximum number of values held by the queue.
+	 * @return True if the oldest value was removed to make room, false otherwise.
+	 */
+	inline bool pushReplacingOldest(T&& value, size_t limit) noexcept {
+		std::lock_guard guard(accessMutex);
+
+		bool removed = false;
+		if(!empty() && (qSize >= limit || (full() && !reserveInternal(std::min(bufferSize * 2, limit))))){
+			popFrontInternal();
+			removed = true;
+		}
+
+		pushInternal(std::move(value));
+
+		return removed;
+	}
+
 	/**
 	 * @brief Checks if a value is present in the queue.
 	 * @param value The value being checked.
@@ -368,7 +518,8 @@ private:
 	size_t qSize = 0;
 	size_t end = 0;
 	bool kill = false;
-	std::mutex accessMutex;
+	mutable std::mutex accessMutex;
+	StaticSemaphore_t waitSemaphoreBuffer;
 	SemaphoreHandle_t waitSemaphore;
 
 private:
@@ -406,6 +557,34 @@ private:
 		return true;
 	}
 
+	/**
+	 * @brief Constructs a value at the back of the queue and wakes up the waiting thread. Has to be called with the access mutex locked on a non-full queue.
+	 * @param value The value being added to the queue.
+	 */
+	inline void pushInternal(T&& value) noexcept {
+		if(!empty()){
+			end = (end + 1) % bufferSize;
+		}
+
+		new(&buffer[end]) T(std::move(value));
+
+		++qSize;
+
+		xSemaphoreGive(waitSemaphore);
+	}
+
+	/**
+	 * @brief Destroys the front value and advances the front of the queue. Has to be called with the access mutex locked on a non-empty queue.
+	 */
+	inline void popFrontInternal() noexcept {
+		buffer[begin].~T();
+
+		--qSize;
+		if(!empty()){
+			begin = (begin + 1) % bufferSize;
+		}
+	}
+
 	inline void removeAt(size_t index) noexcept {
 		if(index >= bufferSize || empty()){
 			return;
@@ -497,4 +676,20 @@ private:
 	}
 };
 
+/**
+ * @brief A queue with inline storage for N elements, which needs no heap allocation for its buffer or its semaphore.
+ * The capacity is fixed, pushing into a full queue fails, unless HeapFallback is set, in which case it resizes onto the heap like Queue.
+ * @tparam T The type of data being held in the queue.
+ * @tparam N The number of elements held inline.
+ * @tparam HeapFallback Whether the queue can grow beyond N elements by moving to the heap.
+ */
+template<typename T, size_t N, bool HeapFallback = false>
+class StaticQueue : public Queue<T, InlineAllocator<T, N, HeapFallback>> {
+public:
+	/**
+	 * @brief Default constructor, sets the queue up with its inline storage.
+	 */
+	inline StaticQueue() noexcept : Queue<T, InlineAllocator<T, N, HeapFallback>>(N) {}
+};
+
 #endif //CMF_QUEUE_H
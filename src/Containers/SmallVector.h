@@ -0,0 +1,317 @@
+#ifndef CMF_SMALLVECTOR_H
+#define CMF_SMALLVECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+/**
+ * @brief A vector which holds its first N elements in storage inside itself, and only moves them to the heap when it grows past N.
+ * Meant for the many short lists kept by objects, events and drivers, which usually hold only a few elements.
+ * Like std::vector, insertion and removal invalidate iterators and references past the affected position,
+ * and growing past the current capacity invalidates all of them. The interface follows the commonly used subset of std::vector.
+ * @tparam T The type of elements.
+ * @tparam N The number of elements held in the inline storage.
+ */
+template<typename T, size_t N>
+class SmallVector {
+public:
+	using value_type = T;
+	using iterator = T*;
+	using const_iterator = const T*;
+
+	/**
+	 * @brief Default empty constructor.
+	 */
+	inline SmallVector() noexcept = default;
+
+	/**
+	 * @brief Constructs the vector from a range of elements.
+	 * @param first Iterator to the first element being copied.
+	 * @param last Iterator past the last element being copied.
+	 */
+	template<typename InputIt>
+	inline SmallVector(InputIt first, InputIt last) noexcept {
+		if constexpr(std::forward_iterator<InputIt>){
+			reserve(std::distance(first, last));
+		}
+
+		for(; first != last; ++first){
+			emplace_back(*first);
+		}
+	}
+
+	/**
+	 * @brief Constructs the vector from a list of elements.
+	 * @param list The elements being copied.
+	 */
+	inline SmallVector(std::initializer_list<T> list) noexcept : SmallVector(list.begin(), list.end()) {}
+
+	/**
+	 * @brief The copy constructor.
+	 * @param other The vector being copied.
+	 */
+	inline SmallVector(const SmallVector& other) noexcept : SmallVector(other.begin(), other.end()) {}
+
+	/**
+	 * @brief The move constructor. Takes over the heap storage of the other vector, or moves its inline elements one by one.
+	 * @param other The vector being moved, left empty.
+	 */
+	inline SmallVector(SmallVector&& other) noexcept {
+		moveFrom(std::move(other));
+	}
+
+	/**
+	 * @brief Destroys all elements and frees memory.
+	 */
+	inline ~SmallVector() noexcept {
+		clear();
+		freeHeap();
+	}
+
+	/**
+	 * @brief Copy assignment.
+	 * @param other The vector being copied.
+	 * @return Reference to this.
+	 */
+	inline SmallVector& operator = (const SmallVector& other) noexcept {
+		if(this == &other){
+			return *this;
+		}
+
+		clear();
+		reserve(other.size());
+
+		for(const T& element : other){
+			emplace_back(element);
+		}
+
+		return *this;
+	}
+
+	/**
+	 * @brief Move assignment.
+	 * @param other The vector being moved, left empty.
+	 * @return Reference to this.
+	 */
+	inline SmallVector& operator = (SmallVector&& other) noexcept {
+		if(this == &other){
+			return *this;
+		}
+
+		clear();
+		freeHeap();
+		moveFrom(std::move(other));
+
+		return *this;
+	}
+
+	inline iterator begin() noexcept { return elements; }
+	inline iterator end() noexcept { return elements + count; }
+	inline const_iterator begin() const noexcept { return elements; }
+	inline const_iterator end() const noexcept { return elements + count; }
+
+	inline T* data() noexcept { return elements; }
+	inline const T* data() const noexcept { return elements; }
+
+	inline T& operator [] (size_t index) noexcept { return elements[index]; }
+	inline const T& operator [] (size_t index) const noexcept { return elements[index]; }
+
+	inline T& front() noexcept { return elements[0]; }
+	inline const T& front() const noexcept { return elements[0]; }
+	inline T& back() noexcept { return elements[count - 1]; }
+	inline const T& back() const noexcept { return elements[count - 1]; }
+
+	/**
+	 * @return The number of elements in the vector.
+	 */
+	inline size_t size() const noexcept {
+		return count;
+	}
+
+	/**
+	 * @return The number of elements the vector can hold without allocating.
+	 */
+	inline size_t capacity() const noexcept {
+		return elementCapacity;
+	}
+
+	/**
+	 * @return True if the vector holds no elements, false otherwise.
+	 */
+	inline bool empty() const noexcept {
+		return count == 0;
+	}
+
+	/**
+	 * @return True if the elements are held in the inline storage, false if they spilled to the heap.
+	 */
+	inline bool isInline() const noexcept {
+		return elements == inlineElements();
+	}
+
+	/**
+	 * @brief Reserves space for the given number of elements, so adding up to it does not allocate.
+	 * @param newCapacity The number of elements.
+	 */
+	inline void reserve(size_t newCapacity) noexcept {
+		if(newCapacity <= elementCapacity){
+			return;
+		}
+
+		T* newElements = std::allocator<T>().allocate(newCapacity);
+		for(size_t i = 0; i < count; ++i){
+			new(&newElements[i]) T(std::move_if_noexcept(elements[i]));
+			elements[i].~T();
+		}
+
+		freeHeap();
+
+		elements = newElements;
+		elementCapacity = newCapacity;
+	}
+
+	/**
+	 * @brief Destroys all elements, keeping the allocated capacity.
+	 */
+	inline void clear() noexcept {
+		std::destroy(begin(), end());
+		count = 0;
+	}
+
+	/**
+	 * @brief Adds an element at the end of the vector.
+	 * @param value The element being copied.
+	 */
+	inline void push_back(const T& value) noexcept {
+		emplace_back(value);
+	}
+
+	/**
+	 * @brief Adds an element at the end of the vector.
+	 * @param value The element being moved.
+	 */
+	inline void push_back(T&& value) noexcept {
+		emplace_back(std::move(value));
+	}
+
+	/**
+	 * @brief Constructs an element at the end of the vector.
+	 * @param args The arguments the element is constructed from.
+	 * @return Reference to the new element.
+	 */
+	template<typename ...Args>
+	inline T& emplace_back(Args&&... args) noexcept {
+		if(count == elementCapacity){
+			// The arguments may refer to an element of this vector, so it is constructed before the elements move
+			T value(std::forward<Args>(args)...);
+			reserve(std::max<size_t>(elementCapacity * 2, 1));
+			return *new(&elements[count++]) T(std::move(value));
+		}
+
+		return *new(&elements[count++]) T(std::forward<Args>(args)...);
+	}
+
+	/**
+	 * @brief Removes the last element.
+	 */
+	inline void pop_back() noexcept {
+		elements[--count].~T();
+	}
+
+	/**
+	 * @brief Removes the element at the given position.
+	 * @param position Iterator to the element being removed.
+	 * @return Iterator to the element following the removed one.
+	 */
+	inline iterator erase(const_iterator position) noexcept {
+		return erase(position, position + 1);
+	}
+
+	/**
+	 * @brief Removes the elements in the given range.
+	 * @param first Iterator to the first element being removed.
+	 * @param last Iterator past the last element being removed.
+	 * @return Iterator to the element following the removed ones.
+	 */
+	inline iterator erase(const_iterator first, const_iterator last) noexcept {
+		iterator from = begin() + (first - begin());
+		if(first == last){
+			return from;
+		}
+
+		iterator newEnd = std::move(from + (last - first), end(), from);
+		std::destroy(newEnd, end());
+		count = newEnd - begin();
+
+		return from;
+	}
+
+	/**
+	 * @brief Removes the element at the given position by moving the last element into its place.
+	 * Cheaper than erase when the order of elements does not matter, since at most one element is moved.
+	 * @param position Iterator to the element being removed.
+	 */
+	inline void eraseUnordered(const_iterator position) noexcept {
+		iterator element = begin() + (position - begin());
+		if(element != &back()){
+			*element = std::move(back());
+		}
+
+		pop_back();
+	}
+
+private:
+	alignas(T) uint8_t storage[N * sizeof(T)];
+	T* elements = inlineElements();
+	size_t count = 0;
+	size_t elementCapacity = N;
+
+private:
+	inline T* inlineElements() noexcept {
+		return reinterpret_cast<T*>(storage);
+	}
+
+	inline const T* inlineElements() const noexcept {
+		return reinterpret_cast<const T*>(storage);
+	}
+
+	inline void freeHeap() noexcept {
+		if(!isInline()){
+			std::allocator<T>().deallocate(elements, elementCapacity);
+		}
+
+		elements = inlineElements();
+		elementCapacity = N;
+	}
+
+	/**
+	 * @brief Takes over the elements of another vector. Has to be called on an empty vector using its inline storage.
+	 * @param other The vector being moved, left empty.
+	 */
+	inline void moveFrom(SmallVector&& other) noexcept {
+		if(!other.isInline()){
+			elements = other.elements;
+			elementCapacity = other.elementCapacity;
+			count = other.count;
+
+			other.elements = other.inlineElements();
+			other.elementCapacity = N;
+			other.count = 0;
+			return;
+		}
+
+		for(size_t i = 0; i < other.count; ++i){
+			new(&elements[i]) T(std::move(other.elements[i]));
+		}
+
+		count = other.count;
+		other.clear();
+	}
+};
+
+#endif //CMF_SMALLVECTOR_H
@@ -7,7 +7,13 @@ Application::Application(TickType_t interval /*= CONFIG_CMF_APPLICATION_TICK_INT
 		ApplicationInstance = this;
 	}
 
+#ifdef CONFIG_CMF_EVENTSCANNER
 	eventScanner = newObject<EventScanner>(static_cast<Object*>(nullptr), false);
+#endif
+
+#ifdef CONFIG_CMF_EVENTTIMER
+	eventTimer = newObject<EventTimer>(static_cast<Object*>(nullptr), false);
+#endif
 }
 
 Application::~Application() noexcept {
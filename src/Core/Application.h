@@ -12,6 +12,7 @@
 #include "Misc/Singleton.h"
 #include "Object/Interface.h"
 #include "Event/EventScanner.h"
+#include "Event/EventTimer.h"
 #include "Object/Class.h"
 
 /**
@@ -64,10 +65,15 @@ public:
 	virtual SubclassOf<GarbageCollector> getGarbageCollectorClass() const noexcept;
 
 	/**
-	 * @return The EventScanner instance for this application.
+	 * @return The EventScanner instance for this application, or nullptr if the scanner thread is disabled with CONFIG_CMF_EVENTSCANNER.
 	 */
 	inline constexpr EventScanner* getEventScanner() const noexcept { return eventScanner.get(); }
 
+	/**
+	 * @return The EventTimer instance broadcasting the scheduled broadcasts of events, or nullptr if it is disabled with CONFIG_CMF_EVENTTIMER.
+	 */
+	inline constexpr EventTimer* getEventTimer() const noexcept { return eventTimer.get(); }
+
 	/**
 	 * @brief Registers a singleton to the application.
 	 * Only one of each type can ever exist registered within the application.
@@ -313,6 +319,7 @@ private:
 	std::set<StrongObjectPtr<Object>> drivers;
 	std::set<StrongObjectPtr<Object>> services;
 	StrongObjectPtr<EventScanner> eventScanner;
+	StrongObjectPtr<EventTimer> eventTimer;
 };
 
 #endif //CMF_APPLICATION_H
\ No newline at end of file
@@ -12,6 +12,7 @@
 #include "Memory/GarbageCollector.h"
 #include "Containers/Queue.h"
 #include "Event/EventHandle.h"
+#include "Event/EventStatsReporter.h"
 #include "Log/Log.h"
 
 /**
@@ -41,11 +42,16 @@ public:
 		if(!TrashCollector.isValid()){
 			CMF_LOG(CMF, Error, "GarbageCollector instance could not be created.");
 		}
+
+#if defined(CONFIG_CMF_EVENT_INSTRUMENTATION) && CONFIG_CMF_EVENT_INSTRUMENTATION_DUMP_INTERVAL > 0
+		StatsReporter = newObject<EventStatsReporter>(*App);
+#endif
 	}
 
 private:
 	inline static StrongObjectPtr<Application> App = nullptr;
 	inline static StrongObjectPtr<GarbageCollector> TrashCollector = nullptr;
+	inline static StrongObjectPtr<EventStatsReporter> StatsReporter = nullptr;
 };
 
 /**
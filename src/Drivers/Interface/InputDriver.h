@@ -5,6 +5,8 @@
 #include "Misc/Enum.h"
 #include "Entity/SyncEntity.h"
 #include "Log/Log.h"
+#include "Containers/FlatMap.h"
+#include "Containers/SmallVector.h"
 
 struct InputPinDef {
 	int port;
@@ -64,9 +66,12 @@ public:
 
 
 protected:
+	// Drivers usually handle only a few pins, which are then held without heap allocation
+	static constexpr size_t InlinePinCount = 8;
+
 	InputDriver() noexcept = default;
 
-	InputDriver(const std::vector<InputPinDef>& inputs) noexcept: inputs(inputs){}
+	InputDriver(const std::vector<InputPinDef>& inputs) noexcept: inputs(inputs.begin(), inputs.end()){}
 
 	void forEachInput(const std::function<void(const InputPinDef&)>& func) const noexcept{
 		for(const auto& input : inputs){
@@ -74,15 +79,15 @@ protected:
 		}
 	}
 
-	std::vector<InputPinDef>& getInputs() noexcept{
+	SmallVector<InputPinDef, InlinePinCount>& getInputs() noexcept{
 		return inputs;
 	}
 
-	std::unordered_map<int, bool>& getStates() noexcept{
+	SmallIntMap<bool>& getStates() noexcept{
 		return states;
 	}
 
-	std::unordered_map<int, bool>& getInversions() noexcept{
+	SmallIntMap<bool>& getInversions() noexcept{
 		return inversions;
 	}
 
@@ -120,19 +125,19 @@ private:
 
 	virtual void performDeregister(InputPinDef input) noexcept{}
 
-	std::vector<InputPinDef> inputs;
+	SmallVector<InputPinDef, InlinePinCount> inputs;
 
 	/**
 	 * Map of cached input values.
 	 * key = port[int] , value = state[bool]
 	 */
-	std::unordered_map<int, bool> states;
+	SmallIntMap<bool> states;
 
 	/**
 	 * Map of inversion settings for each port.
 	 * key = port[int], value = inversion[bool]
 	 */
-	std::unordered_map<int, bool> inversions;
+	SmallIntMap<bool> inversions;
 };
 
 #endif //CMF_INPUTDRIVER_H
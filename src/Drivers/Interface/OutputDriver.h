@@ -5,6 +5,8 @@
 #include "Misc/Enum.h"
 #include "Entity/SyncEntity.h"
 #include "Log/Log.h"
+#include "Containers/FlatMap.h"
+#include "Containers/SmallVector.h"
 
 struct OutputPinDef {
 	int port;
@@ -71,19 +73,22 @@ public:
 	}
 
 protected:
+	// Drivers usually handle only a few pins, which are then held without heap allocation
+	static constexpr size_t InlinePinCount = 8;
+
 	OutputDriver() noexcept = default;
 
-	OutputDriver(const std::vector<OutputPinDef>& outputs) noexcept: outputs(outputs){}
+	OutputDriver(const std::vector<OutputPinDef>& outputs) noexcept: outputs(outputs.begin(), outputs.end()){}
 
-	std::vector<OutputPinDef>& getOutputs() noexcept{
+	SmallVector<OutputPinDef, InlinePinCount>& getOutputs() noexcept{
 		return outputs;
 	}
 
-	std::map<int, float>& getStates() noexcept{
+	SmallIntMap<float>& getStates() noexcept{
 		return states;
 	}
 
-	std::map<int, bool>& getInversions() noexcept{
+	SmallIntMap<bool>& getInversions() noexcept{
 		return inversions;
 	}
 
@@ -124,19 +129,19 @@ private:
 
 	virtual void performDeregister(const OutputPinDef& output) noexcept{}
 
-	std::vector<OutputPinDef> outputs;
+	SmallVector<OutputPinDef, InlinePinCount> outputs;
 
 	/**
 	 * Map of cached output values.
 	 * key = port[int] , value = state[float]
 	 */
-	std::map<int, float> states;
+	SmallIntMap<float> states;
 
 	/**
 	 * Map of inversion settings for each port.
 	 * key = port[int], value = inversion[bool]
 	 */
-	std::map<int, bool> inversions;
+	SmallIntMap<bool> inversions;
 
 };
 
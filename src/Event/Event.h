@@ -1,13 +1,17 @@
 #ifndef CMF_EVENT_H
 #define CMF_EVENT_H
 
-#include <set>
-#include <mutex>
+#include <algorithm>
+#include <atomic>
+#include <tuple>
 #include "EventHandle.h"
+#include "EventRecorder.h"
 #include "Memory/SmartPtr/WeakObjectPtr.h"
 #include "Statics/ApplicationStatics.h"
 #include "EventScanner.h"
 #include "Core/Application.h"
+#include "Containers/SmallVector.h"
+#include "Containers/CopyOnWrite.h"
 
 /**
  * @brief Event class is used to declare event instances to which object function can be bound and executed as callbacks when the event is triggered.
@@ -17,13 +21,33 @@ template<typename ...Args>
 class Event {
 public:
 	/**
-	 * @brief Deletes all contained bound handles and deallocates memory.
+	 * @brief Cancels the scheduled broadcasts, deletes all contained bound handles and deallocates memory.
+	 * An event may not be destroyed while it can still be broadcast from another task, since the broadcast uses the event itself.
+	 * A broadcast running on the EventTimer is waited for, but events added to an EventReplayer have to outlive it.
 	 */
 	inline virtual ~Event() noexcept{
-		std::lock_guard guard(accessMutex);
+		if(scheduledBroadcasts.getCount() > 0){
+			cancelScheduledBroadcasts();
+		}
+
+		if(!handles.read()){
+			return;
+		}
+
+		SmallVector<EventHandle<Args...>*, InlineHandleCount> removed;
+
+		handles.update([&removed](HandleList& list){
+			for(const HandleContainer& container : list){
+				removed.push_back(container.handle);
+			}
+
+			list.clear();
+		});
 
-		for(const HandleContainer& container : handles){
-			delete container.handle;
+		// Handles are stopped and retired the same way as in unbind, so they are not freed under a broadcast still reading the previous list
+		for(EventHandle<Args...>* handle : removed){
+			handle->detach();
+			handles.retire(handle, ReleaseHandle());
 		}
 	}
 
@@ -36,8 +60,7 @@ public:
 			return;
 		}
 
-		std::lock_guard guard(accessMutex);
-		handles.insert({&handle, handle.getOwningObject(), false});
+		insertHandle({&handle, handle.getOwningObject()});
 	}
 
 	/**
@@ -53,73 +76,165 @@ public:
 			return;
 		}
 
-		std::lock_guard guard(accessMutex);
-
-		handles.insert({handle, handle->getOwningObject(), false});
+		insertHandle({handle, handle->getOwningObject()});
 	}
 
 	/**
-	 * @brief Function for binding a callback function directly via templated function reference and object pointer.
+	 * @brief Function for binding a member function directly via templated function reference and object pointer.
 	 * @tparam O Type of Object the function is a member of.
 	 * @tparam F The function type.
 	 * @param object Object instance of which the function is being bound.
 	 * @param function Function being bound.
+	 * @param priority The priority with which the callback is scanned relative to the other ready callbacks of the object.
+	 * @param queueType The type of queue pending calls of the callback are kept in, EventQueueType::Latest only keeps the newest one.
+	 * @param dispatch How calls are delivered to the callback, EventDispatch::SameThread calls it directly when broadcast from the thread of the object.
 	 */
 	template<typename O, typename F>
-	inline void bind(O* object, F&& function) noexcept requires (!std::constructible_from<std::function<void(Args...)>, F>){
+	inline void bind(O* object, F&& function, EventPriority priority = EventPriority::Normal, EventQueueType queueType = DefaultEventQueueType, EventDispatch dispatch = DefaultEventDispatch) noexcept requires std::is_member_function_pointer_v<std::remove_cvref_t<F>> {
 		if(object == nullptr || function == nullptr){
 			return;
 		}
 
-		std::lock_guard guard(accessMutex);
-
 		HandleContainer container;
-		container.handle = new EventHandle<Args...>();
-		container.handle->bind(object, function);
+		container.handle = new EventHandle<Args...>(queueType, dispatch);
+		container.handle->setOverflow(handleOverflow);
+		container.handle->bind(object, std::forward<F>(function), priority);
 		container.owningObject = object;
 
-		handles.insert(container);
+		insertHandle(container);
 	}
 
 	/**
-	 * @brief Function for binding a callback function directly via std::function reference and object pointer.
-	 * @param object Object instance of which the function is being bound.
-	 * @param function Function being bound, in a std::function wrapper.
+	 * @brief Function for binding a callable, such as a lambda or a std::function, directly with an object pointer.
+	 * The callable is stored in the handle as is, without wrapping it into a std::function.
+	 * @param object Object instance owning the callback.
+	 * @param function Callable being bound.
+	 * @param priority The priority with which the callback is scanned relative to the other ready callbacks of the object.
+	 * @param queueType The type of queue pending calls of the callback are kept in, EventQueueType::Latest only keeps the newest one.
+	 * @param dispatch How calls are delivered to the callback, EventDispatch::SameThread calls it directly when broadcast from the thread of the object.
 	 */
 	template<typename F>
-	inline void bind(Object* object, F&& function) noexcept requires std::constructible_from<std::function<void(Args...)>, F> {
-		std::function<void(Args...)> func(function);
+	inline void bind(Object* object, F&& function, EventPriority priority = EventPriority::Normal, EventQueueType queueType = DefaultEventQueueType, EventDispatch dispatch = DefaultEventDispatch) noexcept requires (!std::is_member_function_pointer_v<std::remove_cvref_t<F>> && std::constructible_from<EventCallback<Args...>, F>) {
+		EventCallback<Args...> callback(std::forward<F>(function));
 
-		if(object == nullptr || func == nullptr){
+		if(object == nullptr || !callback){
 			return;
 		}
 
-		std::lock_guard guard(accessMutex);
+		HandleContainer container;
+		container.handle = new EventHandle<Args...>(queueType, dispatch);
+		container.handle->setOverflow(handleOverflow);
+		container.handle->bind(object, std::move(callback), priority);
+		container.owningObject = object;
+
+		insertHandle(container);
+	}
+
+	/**
+	 * @brief Function for binding a batched callback, called once per scan with all calls pending at that moment, instead of once per call.
+	 * @tparam O Type of Object owning the callback.
+	 * @tparam F The type of member function of O, or callable, taking an EventHandle<Args...>::Batch.
+	 * @param object Object instance owning the callback.
+	 * @param function Member function or callable being bound.
+	 * @param priority The priority with which the callback is scanned relative to the other ready callbacks of the object.
+	 * @param queueType The type of queue pending calls of the callback are kept in.
+	 * @param dispatch How calls are delivered to the callback, EventDispatch::SameThread calls it directly when broadcast from the thread of the object.
+	 */
+	template<typename O, typename F>
+	inline void bindBatch(O* object, F&& function, EventPriority priority = EventPriority::Normal, EventQueueType queueType = DefaultEventQueueType, EventDispatch dispatch = DefaultEventDispatch) noexcept {
+		if(object == nullptr){
+			return;
+		}
 
 		HandleContainer container;
-		container.handle = new EventHandle<Args...>();
-		container.handle->bind(object, func);
+		container.handle = new EventHandle<Args...>(queueType, dispatch);
+		container.handle->setOverflow(handleOverflow);
+		container.handle->bindBatch(object, std::forward<F>(function), priority);
 		container.owningObject = object;
 
-		handles.insert(container);
+		insertHandle(container);
+	}
+
+	/**
+	 * @param overflow How the queues of handles created by later binds of callbacks behave when they are full.
+	 * Handles bound directly keep their own overflow behavior.
+	 */
+	inline void setHandleOverflow(const EventOverflow& overflow) noexcept{
+		handleOverflow = overflow;
+	}
+
+	/**
+	 * @param id The ID broadcasts of this event are recorded with by the active EventRecorder, 0 excludes the event from recording.
+	 * Recording is only compiled in when CONFIG_CMF_EVENT_RECORDING is enabled.
+	 */
+	inline void setRecordID(uint32_t id) noexcept{
+		recordID = id;
+	}
+
+	/**
+	 * @return The ID broadcasts of this event are recorded with, 0 if the event is not recorded.
+	 */
+	inline uint32_t getRecordID() const noexcept{
+		return recordID;
+	}
+
+	/**
+	 * @brief Cancels a broadcast scheduled on this event. A periodic broadcast cancelled while it is running finishes, but is not repeated.
+	 * @param id The ID of the scheduled broadcast.
+	 * @return True if the broadcast was scheduled, false if it already happened or was cancelled.
+	 */
+	inline bool cancelScheduledBroadcast(EventTimerID id) noexcept{
+		EventTimer* timer = getTimer();
+		if(timer == nullptr){
+			return false;
+		}
+
+		return timer->cancel(id);
+	}
+
+	/**
+	 * @brief Cancels all broadcasts scheduled on this event. Waits for a broadcast of the event running on the EventTimer to finish.
+	 */
+	inline void cancelScheduledBroadcasts() noexcept{
+		if(EventTimer* timer = getTimer()){
+			timer->cancelAll(scheduledBroadcasts);
+		}
+	}
+
+	/**
+	 * @return The number of broadcasts scheduled on this event, including a cancelled one which is still running.
+	 */
+	inline uint32_t getScheduledBroadcastCount() const noexcept{
+		return scheduledBroadcasts.getCount();
 	}
 
 	/**
 	 * @brief Function for removing bound function via object instance.
+	 * The removed callbacks are not called anymore once this returns, apart from ones already running on another task.
 	 * @param object The object instance whose functions are to be removed.
 	 */
 	inline void unbind(Object* object) noexcept{
-		std::lock_guard guard(accessMutex);
+		SmallVector<EventHandle<Args...>*, InlineHandleCount> removed;
 
-		std::erase_if(handles, [object](const HandleContainer& container){
-			if(container.owningObject == object){
-				delete container.handle;
+		handles.update([object, &removed](HandleList& list){
+			auto it = std::remove_if(list.begin(), list.end(), [object, &removed](const HandleContainer& container){
+				if(container.owningObject == object){
+					removed.push_back(container.handle);
 
-				return true;
-			}
+					return true;
+				}
 
-			return false;
+				return false;
+			});
+
+			list.erase(it, list.end());
 		});
+
+		// Broadcasts which started before the update may still be calling the removed handles, so they are stopped right away but freed later
+		for(EventHandle<Args...>* handle : removed){
+			handle->detach();
+			handles.retire(handle, ReleaseHandle());
+		}
 	}
 
 protected:
@@ -129,18 +244,26 @@ protected:
 	 * @return True if all callback calls were successful, false otherwise.
 	 */
 	virtual inline bool _broadcast(const Args&... args) noexcept{
-		std::lock_guard guard(accessMutex);
-
 		bool succeeded = true;
 
-		// TODO this should return false if app or event scanner are nullptr
+#ifdef CONFIG_CMF_EVENT_RECORDING
+		if(recordID != 0){
+			EventRecorder::record(recordID, args...);
+		}
+#endif
 
-		for(const HandleContainer& container : handles){
-			if(container.handle == nullptr || !container.owningObject.isValid()){
-				continue;
-			}
+		// TODO this should return false if app is nullptr
+
+		// Lock-free read of the current handles, binding and unbinding publish a new list instead of changing this one
+		if(const auto list = handles.read()){
+			for(const HandleContainer& container : *list){
+				// Handles check their owner themselves, under the lock of the ObjectManager
+				if(container.handle == nullptr){
+					continue;
+				}
 
-			succeeded &= container.handle->call(args...);
+				succeeded &= container.handle->call(args...);
+			}
 		}
 
 		if(const Application* app = ApplicationStatics::getApplication()){
@@ -152,28 +275,103 @@ protected:
 		return succeeded;
 	}
 
+	/**
+	 * @brief Internal function used by the derived classes to schedule broadcasts on the EventTimer of the application.
+	 * @param delay Time until the broadcast in milliseconds.
+	 * @param period Time between repeated broadcasts in milliseconds, 0 broadcasts only once.
+	 * @param args Arguments passed to the bound function callbacks, copied until the broadcast.
+	 * @return The ID of the scheduled broadcast, 0 if the application has no EventTimer.
+	 */
+	inline EventTimerID scheduleBroadcast(uint32_t delay, uint32_t period, const Args&... args) noexcept{
+		EventTimer* timer = getTimer();
+		if(timer == nullptr){
+			CMF_LOG(CMF, Warning, "Broadcast scheduled without an EventTimer, enable CONFIG_CMF_EVENTTIMER");
+			return 0;
+		}
+
+		return timer->schedule(new ScheduledBroadcast(*this, args...), delay, period);
+	}
+
 private:
+	// Replays recorded broadcasts through _broadcast, bypassing the owner check of derived events
+	friend class EventReplayer;
+
 	/**
 	 * @brief The internally used handle container which consists of the pointer to the object,
-	 * the handle of event containing the callback function, and ownership flag.
+	 * and the handle of event containing the callback function.
 	 */
 	struct HandleContainer {
 		EventHandle<Args...>* handle = nullptr;
 		WeakObjectPtr<Object> owningObject = nullptr;
+	};
+
+	/**
+	 * @brief Drops the reference the event holds to a retired handle, which frees it unless a scan is still using it.
+	 */
+	struct ReleaseHandle {
+		inline void operator () (const EventHandle<Args...>* handle) const noexcept {
+			const_cast<EventHandle<Args...>*>(handle)->release();
+		}
+	};
 
-		// This is only needed for std::set to work
-		/**
-		 * @brief Less operator.
-		 * @param other The HandleContainer being compared to.
-		 * @return True if handle pointer is less than the other containers handle pointer.
-		 */
-		bool operator < (const HandleContainer& other) const noexcept{
-			return (uint32_t) handle < (uint32_t) other.handle;
+	/**
+	 * @brief Broadcast scheduled on the EventTimer, holding copies of the arguments.
+	 */
+	class ScheduledBroadcast : public EventTimerEntry {
+	public:
+		inline ScheduledBroadcast(Event& event, const Args&... args) noexcept : EventTimerEntry(event.scheduledBroadcasts), event(event), args(args...) {}
+
+		inline void fire() noexcept override{
+			std::apply([this](const auto&... values){
+				// Not through the virtual call, since derived events may already be destroyed by a task waiting for this broadcast in ~Event
+				event.Event<Args...>::_broadcast(values...);
+			}, args);
 		}
+
+	private:
+		Event& event;
+		std::tuple<std::remove_cvref_t<Args>...> args;
 	};
 
-	std::set<HandleContainer> handles;
-	std::mutex accessMutex;
+	// Most events only have a few bound handles, which are then held in the same allocation as the list snapshot
+	static constexpr size_t InlineHandleCount = 4;
+
+	using HandleList = SmallVector<HandleContainer, InlineHandleCount>;
+
+	CopyOnWrite<HandleList> handles;
+	EventOverflow handleOverflow;
+	uint32_t recordID = 0;
+	EventTimerList scheduledBroadcasts;
+
+private:
+	/**
+	 * @return The EventTimer of the application, nullptr if there is none.
+	 */
+	inline static EventTimer* getTimer() noexcept{
+		if(const Application* app = ApplicationStatics::getApplication()){
+			return app->getEventTimer();
+		}
+
+		return nullptr;
+	}
+
+	/**
+	 * @brief Adds a handle container, unless its handle is already bound.
+	 * @param container The handle container being added.
+	 */
+	inline void insertHandle(const HandleContainer& container) noexcept{
+		handles.update([&container](HandleList& list){
+			const bool bound = std::any_of(list.begin(), list.end(), [&container](const HandleContainer& other){
+				return other.handle == container.handle;
+			});
+
+			if(bound){
+				return;
+			}
+
+			list.push_back(container);
+		});
+	}
 };
 
 #endif //CMF_EVENT_H
\ No newline at end of file
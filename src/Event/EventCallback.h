@@ -0,0 +1,268 @@
+#ifndef CMF_EVENTCALLBACK_H
+#define CMF_EVENTCALLBACK_H
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <sdkconfig.h>
+
+/**
+ * @brief Type erased callback of an event handle, which never allocates.
+ * Holds either a member function bound to an object, or any callable such as a lambda or a std::function,
+ * in a fixed size buffer inside itself. Callables larger than the buffer are rejected at compile time.
+ * Calling it is a single indirect call, with the arguments passed by reference.
+ * @tparam Args The types of arguments the callback is called with.
+ */
+template<typename ...Args>
+class EventCallback {
+private:
+	template<typename T>
+	struct IsStdFunction : std::false_type {};
+
+	template<typename S>
+	struct IsStdFunction<std::function<S>> : std::true_type {};
+
+	/**
+	 * @brief Member function bound to an object instance.
+	 */
+	template<typename O, typename F>
+	struct MemberBinding {
+		O* object;
+		F function;
+
+		inline void operator () (const Args&... args) const noexcept {
+			(object->*function)(args...);
+		}
+	};
+
+public:
+	/**
+	 * @brief The number of bytes available for the stored callable.
+	 * Always fits a bound member function and a std::function, so those never fail to compile.
+	 */
+	static constexpr size_t StorageSize = std::max({
+		(size_t) CONFIG_CMF_EVENT_CALLBACK_STORAGE_SIZE,
+		sizeof(MemberBinding<EventCallback, void (EventCallback::*)()>),
+		sizeof(std::function<void(Args...)>)
+	});
+
+public:
+	/**
+	 * @brief Default constructor of an empty callback.
+	 */
+	inline EventCallback() noexcept = default;
+
+	/**
+	 * @brief Constructor of an empty callback.
+	 */
+	inline EventCallback(std::nullptr_t) noexcept {}
+
+	/**
+	 * @brief Constructs the callback from a member function bound to an object instance.
+	 * @tparam O The type of object the function is a member of.
+	 * @tparam F The type of member function.
+	 * @param object The instance of object the function is called on.
+	 * @param function The member function being bound.
+	 */
+	template<typename O, typename F> requires std::is_member_function_pointer_v<std::remove_cvref_t<F>>
+	inline EventCallback(O* object, F&& function) noexcept {
+		if(object == nullptr || function == nullptr){
+			return;
+		}
+
+		emplace(MemberBinding<O, std::remove_cvref_t<F>>{ object, function });
+	}
+
+	/**
+	 * @brief Constructs the callback from a callable, such as a lambda, function pointer or std::function.
+	 * Empty std::functions and null function pointers result in an empty callback.
+	 * @tparam F The type of callable, which has to fit in StorageSize bytes.
+	 * @param function The callable being stored.
+	 */
+	template<typename F> requires (!std::same_as<std::remove_cvref_t<F>, EventCallback> && std::invocable<std::decay_t<F>&, const Args&...>)
+	inline EventCallback(F&& function) noexcept {
+		using C = std::decay_t<F>;
+
+		if constexpr(std::is_pointer_v<C> || IsStdFunction<C>::value){
+			if(function == nullptr){
+				return;
+			}
+		}
+
+		emplace(C(std::forward<F>(function)));
+	}
+
+	/**
+	 * @brief The copy constructor.
+	 * @param other The callback being copied.
+	 */
+	inline EventCallback(const EventCallback& other) noexcept {
+		copyFrom(other);
+	}
+
+	/**
+	 * @brief The move constructor.
+	 * @param other The callback being moved, left empty.
+	 */
+	inline EventCallback(EventCallback&& other) noexcept {
+		moveFrom(std::move(other));
+	}
+
+	/**
+	 * @brief Destroys the stored callable.
+	 */
+	inline ~EventCallback() noexcept {
+		reset();
+	}
+
+	/**
+	 * @brief Copy assignment.
+	 * @param other The callback being copied.
+	 * @return Reference to this.
+	 */
+	inline EventCallback& operator = (const EventCallback& other) noexcept {
+		if(this != &other){
+			reset();
+			copyFrom(other);
+		}
+
+		return *this;
+	}
+
+	/**
+	 * @brief Move assignment.
+	 * @param other The callback being moved, left empty.
+	 * @return Reference to this.
+	 */
+	inline EventCallback& operator = (EventCallback&& other) noexcept {
+		if(this != &other){
+			reset();
+			moveFrom(std::move(other));
+		}
+
+		return *this;
+	}
+
+	/**
+	 * @brief Empties the callback.
+	 * @return Reference to this.
+	 */
+	inline EventCallback& operator = (std::nullptr_t) noexcept {
+		reset();
+		return *this;
+	}
+
+	/**
+	 * @return True if a callable is stored, false otherwise.
+	 */
+	inline explicit operator bool() const noexcept {
+		return invoker != nullptr;
+	}
+
+	inline bool operator == (std::nullptr_t) const noexcept {
+		return invoker == nullptr;
+	}
+
+	/**
+	 * @brief Calls the stored callable. The callback must not be empty.
+	 * @param args The arguments the callable is called with.
+	 */
+	inline void operator () (const Args&... args) const noexcept {
+		invoker(storage, args...);
+	}
+
+	/**
+	 * @brief Destroys the stored callable, leaving the callback empty.
+	 */
+	inline void reset() noexcept {
+		if(manager != nullptr){
+			manager(Operation::Destroy, storage, nullptr);
+		}
+
+		invoker = nullptr;
+		manager = nullptr;
+	}
+
+private:
+	enum class Operation : uint8_t {
+		Copy,
+		Move,
+		Destroy
+	};
+
+	using Invoker = void (*)(void* storage, const Args&... args);
+	using Manager = void (*)(Operation operation, void* destination, void* source);
+
+	alignas(std::max_align_t) mutable uint8_t storage[StorageSize];
+	Invoker invoker = nullptr;
+
+	// Left null for trivially copyable callables, such as bound member functions and lambdas capturing only pointers, which are copied bytewise
+	Manager manager = nullptr;
+
+private:
+	template<typename C>
+	inline void emplace(C&& callable) noexcept {
+		using T = std::remove_cvref_t<C>;
+
+		static_assert(sizeof(T) <= StorageSize, "Callable does not fit into the event callback storage, increase CONFIG_CMF_EVENT_CALLBACK_STORAGE_SIZE or capture less");
+		static_assert(alignof(T) <= alignof(std::max_align_t), "Callable is over-aligned for the event callback storage");
+
+		new(storage) T(std::forward<C>(callable));
+
+		invoker = [](void* storage, const Args&... args){
+			(*std::launder(reinterpret_cast<T*>(storage)))(args...);
+		};
+
+		if constexpr(!std::is_trivially_copyable_v<T>){
+			manager = [](Operation operation, void* destination, void* source){
+				T* callable = std::launder(reinterpret_cast<T*>(source != nullptr ? source : destination));
+
+				switch(operation){
+					case Operation::Copy:
+						new(destination) T(*callable);
+						break;
+					case Operation::Move:
+						new(destination) T(std::move(*callable));
+						callable->~T();
+						break;
+					case Operation::Destroy:
+						callable->~T();
+						break;
+				}
+			};
+		}
+	}
+
+	inline void copyFrom(const EventCallback& other) noexcept {
+		if(other.manager != nullptr){
+			other.manager(Operation::Copy, storage, other.storage);
+		}else if(other.invoker != nullptr){
+			memcpy(storage, other.storage, StorageSize);
+		}
+
+		invoker = other.invoker;
+		manager = other.manager;
+	}
+
+	inline void moveFrom(EventCallback&& other) noexcept {
+		if(other.manager != nullptr){
+			other.manager(Operation::Move, storage, other.storage);
+		}else if(other.invoker != nullptr){
+			memcpy(storage, other.storage, StorageSize);
+		}
+
+		invoker = other.invoker;
+		manager = other.manager;
+
+		other.invoker = nullptr;
+		other.manager = nullptr;
+	}
+};
+
+#endif //CMF_EVENTCALLBACK_H
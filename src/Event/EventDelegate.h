@@ -20,6 +20,26 @@ public:
 		return _broadcast(args...);
 	}
 
+	/**
+	 * @brief Schedules a broadcast after a delay on the EventTimer.
+	 * @param delay Time until the broadcast in milliseconds.
+	 * @param args The arguments being broadcast, copied until the broadcast.
+	 * @return The ID of the scheduled broadcast used to cancel it, 0 if it could not be scheduled.
+	 */
+	inline EventTimerID broadcastAfter(uint32_t delay, const Args&... args) noexcept{
+		return this->scheduleBroadcast(delay, 0, args...);
+	}
+
+	/**
+	 * @brief Schedules a periodic broadcast on the EventTimer, repeated until it is cancelled.
+	 * @param period Time between broadcasts in milliseconds, the first one happens after one period.
+	 * @param args The arguments being broadcast, copied until the broadcast is cancelled.
+	 * @return The ID of the scheduled broadcast used to cancel it, 0 if it could not be scheduled.
+	 */
+	inline EventTimerID broadcastEvery(uint32_t period, const Args&... args) noexcept{
+		return this->scheduleBroadcast(period, period, args...);
+	}
+
 private:
 	virtual inline bool _broadcast(const Args&... args) noexcept override{
 		return Event<Args...>::_broadcast(args...);
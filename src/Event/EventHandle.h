@@ -1,13 +1,22 @@
 #ifndef CMF_EVENTHANDLE_H
 #define CMF_EVENTHANDLE_H
 
+#include <atomic>
 #include <concepts>
-#include <functional>
+#include <span>
 #include <tuple>
 #include <forward_list>
+#include <variant>
+#include <vector>
 #include "Object/Object.h"
 #include "Memory/SmartPtr/WeakObjectPtr.h"
 #include "Containers/Queue.h"
+#include "Containers/MPSCQueue.h"
+#include "Containers/LatestValue.h"
+#include "Containers/IntrusiveQueue.h"
+#include "EventPriority.h"
+#include "EventCallback.h"
+#include "EventStats.h"
 #include "Util/stdafx.h"
 #include "Log/Log.h"
 #include "Statics/ApplicationStatics.h"
@@ -15,1819 +24,473 @@
 #include "Core/Application.h"
 
 /**
- * @brief A static helper function used to simplify binding of object member functions to events as callbacks.
- * @tparam Args The types of arguments of the bound function.
+ * @brief Base event handle interface demanding implementation of probing and scanning functionality from the event handle implementations.
  */
-template<typename ...Args>
-struct BindHelper {
-	/**
-	 * @brief Binding a function with more than 29 argument is not possible.
-	 * This function variation ensures correct error logging in such case.
-	 * @tparam O The type of object the function is a member of.
-	 * @tparam F The type of function being bound.
-	 * @param object The object instance upon which the function will be bound and called.
-	 * @param function The function being bound.
-	 * @return Always nullptr.
-	 */
-	template<typename O, typename F>
-	inline static constexpr std::function<void(Args...)> get(O* object, F&& function) noexcept {
-		CMF_LOG(CMF, Error, "Unsupported bind attempted on a function with more than 31 argument.");
-		return nullptr;
-	}
-
-	/**
-	 * @brief Function helper for binding a function with various number of arguments.
-	 * @tparam O The type of object the function is a member of.
-	 * @tparam F The type of function being bound.
-	 * @param object The object instance upon which the function will be bound and called.
-	 * @param function The function being bound.
-	 * @return The object member function in a std::function wrapper.
-	 */
-	template<typename O, typename F>
-	inline static constexpr std::function<void(Args...)> get(O* object, F&& function) noexcept requires (sizeof...(Args) == 0) {
-		return std::bind(function, object);
-	}
-
-	/**
-	 * @brief Function helper for binding a function with various number of arguments.
-	 * @tparam O The type of object the function is a member of.
-	 * @tparam F The type of function being bound.
-	 * @param object The object instance upon which the function will be bound and called.
-	 * @param function The function being bound.
-	 * @return The object member function in a std::function wrapper.
-	 */
-	template<typename O, typename F>
-	inline static constexpr std::function<void(Args...)> get(O* object, F&& function) noexcept requires (sizeof...(Args) == 1) {
-		return std::bind(function, object, std::placeholders::_1);
-	}
-
-	/**
-	 * @brief Function helper for binding a function with various number of arguments.
-	 * @tparam O The type of object the function is a member of.
-	 * @tparam F The type of function being bound.
-	 * @param object The object instance upon which the function will be bound and called.
-	 * @param function The function being bound.
-	 * @return The object member function in a std::function wrapper.
-	 */
-	template<typename O, typename F>
-	inline static constexpr std::function<void(Args...)> get(O* object, F&& function) noexcept requires (sizeof...(Args) == 2) {
-		return std::bind(function, object, std::placeholders::_1,
-						 std::placeholders::_2);
-	}
-
-	/**
-	 * @brief Function helper for binding a function with various number of arguments.
-	 * @tparam O The type of object the function is a member of.
-	 * @tparam F The type of function being bound.
-	 * @param object The object instance upon which the function will be bound and called.
-	 * @param function The function being bound.
-	 * @return The object member function in a std::function wrapper.
-	 */
-	template<typename O, typename F>
-	inline static constexpr std::function<void(Args...)> get(O* object, F&& function) noexcept requires (sizeof...(Args) == 3) {
-		return std::bind(function, object, std::placeholders::_1,
-						 std::placeholders::_2,
-						 std::placeholders::_3);
-	}
-
-	/**
-	 * @brief Function helper for binding a function with various number of arguments.
-	 * @tparam O The type of object the function is a member of.
-	 * @tparam F The type of function being bound.
-	 * @param object The object instance upon which the function will be bound and called.
-	 * @param function The function being bound.
-	 * @return The object member function in a std::function wrapper.
-	 */
-	template<typename O, typename F>
-	inline static constexpr std::function<void(Args...)> get(O* object, F&& function) noexcept requires (sizeof...(Args) == 4) {
-		return std::bind(function, object, std::placeholders::_1,
-						 std::placeholders::_2,
-						 std::placeholders::_3,
-						 std::placeholders::_4);
-	}
-
-	/**
-	 * @brief Function helper for binding a function with various number of arguments.
-	 * @tparam O The type of object the function is a member of.
-	 * @tparam F The type of function being bound.
-	 * @param object The object instance upon which the function will be bound and called.
-	 * @param function The function being bound.
-	 * @return The object member function in a std::function wrapper.
-	 */
-	template<typename O, typename F>
-	inline static constexpr std::function<void(Args...)> get(O* object, F&& function) noexcept requires (sizeof...(Args) == 5) {
-		return std::bind(function, object, std::placeholders::_1,
-						 std::placeholders::_2,
-						 std::placeholders::_3,
-						 std::placeholders::_4,
-						 std::placeholders::_5);
-	}
-
-	/**
-	 * @brief Function helper for binding a function with various number of arguments.
-	 * @tparam O The type of object the function is a member of.
-	 * @tparam F The type of function being bound.
-	 * @param object The object instance upon which the function will be bound and called.
-	 * @param function The function being bound.
-	 * @return The object member function in a std::function wrapper.
-	 */
-	template<typename O, typename F>
-	inline static constexpr std::function<void(Args...)> get(O* object, F&& function) noexcept requires (sizeof...(Args) == 6) {
-		return std::bind(function, object, std::placeholders::_1,
-									std::placeholders::_2,
-									std::placeholders::_3,
-									std::placeholders::_4,
-									std::placeholders::_5,
-									std::placeholders::_6);
-	}
-
-	/**
-	 * @brief Function helper for binding a function with various number of arguments.
-	 * @tparam O The type of object the function is a member of.
-	 * @tparam F The type of function being bound.
-	 * @param object The object instance upon which the function will be bound and called.
-	 * @param function The function being bound.
-	 * @return The object member function in a std::function wrapper.
-	 */
-	template<typename O, typename F>
-	inline static constexpr std::function<void(Args...)> get(O* object, F&& function) noexcept requires (sizeof...(Args) == 7) {
-		return std::bind(function, object, std::placeholders::_1,
-						 std::placeholders::_2,
-						 std::placeholders::_3,
-						 std::placeholders::_4,
-						 std::placeholders::_5,
-						 std::placeholders::_6,
-						 std::placeholders::_7);
-	}
-
-	/**
-	 * @brief Function helper for binding a function with various number of arguments.
-	 * @tparam O The type of object the function is a member of.
-	 * @tparam F The type of function being bound.
-	 * @param object The object instance upon which the function will be bound and called.
-	 * @param function The function being bound.
-	 * @return The object member function in a std::function wrapper.
-	 */
-	template<typename O, typename F>
-	inline static constexpr std::function<void(Args...)> get(O* object, F&& function) noexcept requires (sizeof...(Args) == 8) {
-		return std::bind(function, object, std::placeholders::_1,
-						 std::placeholders::_2,
-						 std::placeholders::_3,
-						 std::placeholders::_4,
-						 std::placeholders::_5,
-						 std::placeholders::_6,
-						 std::placeholders::_7,
-						 std::placeholders::_8);
-	}
-
-	/**
-	 * @brief Function helper for binding a function with various number of arguments.
-	 * @tparam O The type of object the function is a member of.
-	 * @tparam F The type of function being bound.
-	 * @param object The object instance upon which the function will be bound and called.
-	 * @param function The function being bound.
-	 * @return The object member function in a std::function wrapper.
-	 */
-	template<typename O, typename F>
-	inline static constexpr std::function<void(Args...)> get(O* object, F&& function) noexcept requires (sizeof...(Args) == 9) {
-		return std::bind(function, object, std::placeholders::_1,
-						 std::placeholders::_2,
-						 std::placeholders::_3,
-						 std::placeholders::_4,
-						 std::placeholders::_5,
-						 std::placeholders::_6,
-						 std::placeholders::_7,
-						 std::placeholders::_8,
-						 std::placeholders::_9);
-	}
-
-	/**
-	 * @brief Function helper for binding a function with various number of arguments.
-	 * @tparam O The type of object the function is a member of.
-	 * @tparam F The type of function being bound.
-	 * @param object The object instance upon which the function will be bound and called.
-	 * @param function The function being bound.
-	 * @return The object member function in a std::function wrapper.
-	 */
-	template<typename O, typename F>
-	inline static constexpr std::function<void(Args...)> get(O* object, F&& function) noexcept requires (sizeof...(Args) == 10) {
-		return std::bind(function, object, std::placeholders::_1,
-						 std::placeholders::_2,
-						 std::placeholders::_3,
-						 std::placeholders::_4,
-						 std::placeholders::_5,
-						 std::placeholders::_6,
-						 std::placeholders::_7,
-						 std::placeholders::_8,
-						 std::placeholders::_9,
-						 std::placeholders::_10);
-	}
-
-	/**
-	 * @brief Function helper for binding a function with various number of arguments.
-	 * @tparam O The type of object the function is a member of.
-	 * @tparam F The type of function being bound.
-	 * @param object The object instance upon which the function will be bound and called.
-	 * @param function The function being bound.
-	 * @return The object member function in a std::function wrapper.
-	 */
-	template<typename O, typename F>
-	inline static constexpr std::function<void(Args...)> get(O* object, F&& function) noexcept requires (sizeof...(Args) == 11) {
-		return std::bind(function, object, std::placeholders::_1,
-						 std::placeholders::_2,
-						 std::placeholders::_3,
-						 std::placeholders::_4,
-						 std::placeholders::_5,
-						 std::placeholders::_6,
-						 std::placeholders::_7,
-						 std::placeholders::_8,
-						 std::placeholders::_9,
-						 std::placeholders::_10,
-						 std::placeholders::_11);
-	}
-
-	/**
-	 * @brief Function helper for binding a function with various number of arguments.
-	 * @tparam O The type of object the function is a member of.
-	 * @tparam F The type of function being bound.
-	 * @param object The object instance upon which the function will be bound and called.
-	 * @param function The function being bound.
-	 * @return The object member function in a std::function wrapper.
-	 */
-	template<typename O, typename F>
-	inline static constexpr std::function<void(Args...)> get(O* object, F&& function) noexcept requires (sizeof...(Args) == 12) {
-		return std::bind(function, object, std::placeholders::_1,
-						 std::placeholders::_2,
-						 std::placeholders::_3,
-						 std::placeholders::_4,
-						 std::placeholders::_5,
-						 std::placeholders::_6,
-						 std::placeholders::_7,
-						 std::placeholders::_8,
-						 std::placeholders::_9,
-						 std::placeholders::_10,
-						 std::placeholders::_11,
-						 std::placeholders::_12);
-	}
-
-	/**
-	 * @brief Function helper for binding a function with various number of arguments.
-	 * @tparam O The type of object the function is a member of.
-	 * @tparam F The type of function being bound.
-	 * @param object The object instance upon which the function will be bound and called.
-	 * @param function The function being bound.
-	 * @return The object member function in a std::function wrapper.
-	 */
-	template<typename O, typename F>
-	inline static constexpr std::function<void(Args...)> get(O* object, F&& function) noexcept requires (sizeof...(Args) == 13) {
-		return std::bind(function, object, std::placeholders::_1,
-						 std::placeholders::_2,
-						 std::placeholders::_3,
-						 std::placeholders::_4,
-						 std::placeholders::_5,
-						 std::placeholders::_6,
-						 std::placeholders::_7,
-						 std::placeholders::_8,
-						 std::placeholders::_9,
-						 std::placeholders::_10,
-						 std::placeholders::_11,
-						 std::placeholders::_12,
-						 std::placeholders::_13);
-	}
-
-	/**
-	 * @brief Function helper for binding a function with various number of arguments.
-	 * @tparam O The type of object the function is a member of.
-	 * @tparam F The type of function being bound.
-	 * @param object The object instance upon which the function will be bound and called.
-	 * @param function The function being bound.
-	 * @return The object member function in a std::function wrapper.
-	 */
-	template<typename O, typename F>
-	inline static constexpr std::function<void(Args...)> get(O* object, F&& function) noexcept requires (sizeof...(Args) == 14) {
-		return std::bind(function, object, std::placeholders::_1,
-						 std::placeholders::_2,
-						 std::placeholders::_3,
-						 std::placeholders::_4,
-						 std::placeholders::_5,
-						 std::placeholders::_6,
-						 std::placeholders::_7,
-						 std::placeholders::_8,
-						 std::placeholders::_9,
-						 std::placeholders::_10,
-						 std::placeholders::_11,
-						 std::placeholders::_12,
-						 std::placeholders::_13,
-						 std::placeholders::_14);
-	}
-
-	/**
-	 * @brief Function helper for binding a function with various number of arguments.
-	 * @tparam O The type of object the function is a member of.
-	 * @tparam F The type of function being bound.
-	 * @param object The object instance upon which the function will be bound and called.
-	 * @param function The function being bound.
-	 * @return The object member function in a std::function wrapper.
-	 */
-	template<typename O, typename F>
-	inline static constexpr std::function<void(Args...)> get(O* object, F&& function) noexcept requires (sizeof...(Args) == 15) {
-		return std::bind(function, object, std::placeholders::_1,
-						 std::placeholders::_2,
-						 std::placeholders::_3,
-						 std::placeholders::_4,
-						 std::placeholders::_5,
-						 std::placeholders::_6,
-						 std::placeholders::_7,
-						 std::placeholders::_8,
-						 std::placeholders::_9,
-						 std::placeholders::_10,
-						 std::placeholders::_11,
-						 std::placeholders::_12,
-						 std::placeholders::_13,
-						 std::placeholders::_14,
-						 std::placeholders::_15);
-	}
-
-	/**
-	 * @brief Function helper for binding a function with various number of arguments.
-	 * @tparam O The type of object the function is a member of.
-	 * @tparam F The type of function being bound.
-	 * @param object The object instance upon which the function will be bound and called.
-	 * @param function The function being bound.
-	 * @return The object member function in a std::function wrapper.
-	 */
-	template<typename O, typename F>
-	inline static constexpr std::function<void(Args...)> get(O* object, F&& function) noexcept requires (sizeof...(Args) == 16) {
-		return std::bind(function, object, std::placeholders::_1,
-						 std::placeholders::_2,
-						 std::placeholders::_3,
-						 std::placeholders::_4,
-						 std::placeholders::_5,
-						 std::placeholders::_6,
-						 std::placeholders::_7,
-						 std::placeholders::_8,
-						 std::placeholders::_9,
-						 std::placeholders::_10,
-						 std::placeholders::_11,
-						 std::placeholders::_12,
-						 std::placeholders::_13,
-						 std::placeholders::_14,
-						 std::placeholders::_15,
-						 std::placeholders::_16);
-	}
-
-	/**
-	 * @brief Function helper for binding a function with various number of arguments.
-	 * @tparam O The type of object the function is a member of.
-	 * @tparam F The type of function being bound.
-	 * @param object The object instance upon which the function will be bound and called.
-	 * @param function The function being bound.
-	 * @return The object member function in a std::function wrapper.
-	 */
-	template<typename O, typename F>
-	inline static constexpr std::function<void(Args...)> get(O* object, F&& function) noexcept requires (sizeof...(Args) == 17) {
-		return std::bind(function, object, std::placeholders::_1,
-						 std::placeholders::_2,
-						 std::placeholders::_3,
-						 std::placeholders::_4,
-						 std::placeholders::_5,
-						 std::placeholders::_6,
-						 std::placeholders::_7,
-						 std::placeholders::_8,
-						 std::placeholders::_9,
-						 std::placeholders::_10,
-						 std::placeholders::_11,
-						 std::placeholders::_12,
-						 std::placeholders::_13,
-						 std::placeholders::_14,
-						 std::placeholders::_15,
-						 std::placeholders::_16,
-						 std::placeholders::_17);
-	}
-
-	/**
-	 * @brief Function helper for binding a function with various number of arguments.
-	 * @tparam O The type of object the function is a member of.
-	 * @tparam F The type of function being bound.
-	 * @param object The object instance upon which the function will be bound and called.
-	 * @param function The function being bound.
-	 * @return The object member function in a std::function wrapper.
-	 */
-	template<typename O, typename F>
-	inline static constexpr std::function<void(Args...)> get(O* object, F&& function) noexcept requires (sizeof...(Args) == 18) {
-		return std::bind(function, object, std::placeholders::_1,
-						 std::placeholders::_2,
-						 std::placeholders::_3,
-						 std::placeholders::_4,
-						 std::placeholders::_5,
-						 std::placeholders::_6,
-						 std::placeholders::_7,
-						 std::placeholders::_8,
-						 std::placeholders::_9,
-						 std::placeholders::_10,
-						 std::placeholders::_11,
-						 std::placeholders::_12,
-						 std::placeholders::_13,
-						 std::placeholders::_14,
-						 std::placeholders::_15,
-						 std::placeholders::_16,
-						 std::placeholders::_17,
-						 std::placeholders::_18);
-	}
-
-	/**
-	 * @brief Function helper for binding a function with various number of arguments.
-	 * @tparam O The type of object the function is a member of.
-	 * @tparam F The type of function being bound.
-	 * @param object The object instance upon which the function will be bound and called.
-	 * @param function The function being bound.
-	 * @return The object member function in a std::function wrapper.
-	 */
-	template<typename O, typename F>
-	inline static constexpr std::function<void(Args...)> get(O* object, F&& function) noexcept requires (sizeof...(Args) == 19) {
-		return std::bind(function, object, std::placeholders::_1,
-						 std::placeholders::_2,
-						 std::placeholders::_3,
-						 std::placeholders::_4,
-						 std::placeholders::_5,
-						 std::placeholders::_6,
-						 std::placeholders::_7,
-						 std::placeholders::_8,
-						 std::placeholders::_9,
-						 std::placeholders::_10,
-						 std::placeholders::_11,
-						 std::placeholders::_12,
-						 std::placeholders::_13,
-						 std::placeholders::_14,
-						 std::placeholders::_15,
-						 std::placeholders::_16,
-						 std::placeholders::_17,
-						 std::placeholders::_18,
-						 std::placeholders::_19);
-	}
-
-	/**
-	 * @brief Function helper for binding a function with various number of arguments.
-	 * @tparam O The type of object the function is a member of.
-	 * @tparam F The type of function being bound.
-	 * @param object The object instance upon which the function will be bound and called.
-	 * @param function The function being bound.
-	 * @return The object member function in a std::function wrapper.
-	 */
-	template<typename O, typename F>
-	inline static constexpr std::function<void(Args...)> get(O* object, F&& function) noexcept requires (sizeof...(Args) == 20) {
-		return std::bind(function, object, std::placeholders::_1,
-						 std::placeholders::_2,
-						 std::placeholders::_3,
-						 std::placeholders::_4,
-						 std::placeholders::_5,
-						 std::placeholders::_6,
-						 std::placeholders::_7,
-						 std::placeholders::_8,
-						 std::placeholders::_9,
-						 std::placeholders::_10,
-						 std::placeholders::_11,
-						 std::placeholders::_12,
-						 std::placeholders::_13,
-						 std::placeholders::_14,
-						 std::placeholders::_15,
-						 std::placeholders::_16,
-						 std::placeholders::_17,
-						 std::placeholders::_18,
-						 std::placeholders::_19,
-						 std::placeholders::_20);
-	}
-
+class EventHandleBase : public IntrusiveQueueNode<EventHandleBase, EventPriorityCount> {
+public:
 	/**
-	 * @brief Function helper for binding a function with various number of arguments.
-	 * @tparam O The type of object the function is a member of.
-	 * @tparam F The type of function being bound.
-	 * @param object The object instance upon which the function will be bound and called.
-	 * @param function The function being bound.
-	 * @return The object member function in a std::function wrapper.
-	 */
-	template<typename O, typename F>
-	inline static constexpr std::function<void(Args...)> get(O* object, F&& function) noexcept requires (sizeof...(Args) == 21) {
-		return std::bind(function, object, std::placeholders::_1,
-						 std::placeholders::_2,
-						 std::placeholders::_3,
-						 std::placeholders::_4,
-						 std::placeholders::_5,
-						 std::placeholders::_6,
-						 std::placeholders::_7,
-						 std::placeholders::_8,
-						 std::placeholders::_9,
-						 std::placeholders::_10,
-						 std::placeholders::_11,
-						 std::placeholders::_12,
-						 std::placeholders::_13,
-						 std::placeholders::_14,
-						 std::placeholders::_15,
-						 std::placeholders::_16,
-						 std::placeholders::_17,
-						 std::placeholders::_18,
-						 std::placeholders::_19,
-						 std::placeholders::_20,
-						 std::placeholders::_21);
-	}
+	* @brief Default destructor.
+	*/
+	virtual ~EventHandleBase() = default;
 
 	/**
-	 * @brief Function helper for binding a function with various number of arguments.
-	 * @tparam O The type of object the function is a member of.
-	 * @tparam F The type of function being bound.
-	 * @param object The object instance upon which the function will be bound and called.
-	 * @param function The function being bound.
-	 * @return The object member function in a std::function wrapper.
+	 * @brief A function used to check if an event trigger is queued or not.
+	 * @param wait The wait time for the check.
+	 * @return True if there is a queued event trigger.
 	 */
-	template<typename O, typename F>
-	inline static constexpr std::function<void(Args...)> get(O* object, F&& function) noexcept requires (sizeof...(Args) == 22) {
-		return std::bind(function, object, std::placeholders::_1,
-						 std::placeholders::_2,
-						 std::placeholders::_3,
-						 std::placeholders::_4,
-						 std::placeholders::_5,
-						 std::placeholders::_6,
-						 std::placeholders::_7,
-						 std::placeholders::_8,
-						 std::placeholders::_9,
-						 std::placeholders::_10,
-						 std::placeholders::_11,
-						 std::placeholders::_12,
-						 std::placeholders::_13,
-						 std::placeholders::_14,
-						 std::placeholders::_15,
-						 std::placeholders::_16,
-						 std::placeholders::_17,
-						 std::placeholders::_18,
-						 std::placeholders::_19,
-						 std::placeholders::_20,
-						 std::placeholders::_21,
-						 std::placeholders::_22);
-	}
+	inline virtual bool probe(TickType_t wait) noexcept = 0;
 
 	/**
-	 * @brief Function helper for binding a function with various number of arguments.
-	 * @tparam O The type of object the function is a member of.
-	 * @tparam F The type of function being bound.
-	 * @param object The object instance upon which the function will be bound and called.
-	 * @param function The function being bound.
-	 * @return The object member function in a std::function wrapper.
+	 * @brief A function used to scan and process callbacks of queued event triggers.
+	 * @param wait The wait time for the queued event pop.
 	 */
-	template<typename O, typename F>
-	inline static constexpr std::function<void(Args...)> get(O* object, F&& function) noexcept requires (sizeof...(Args) == 23) {
-		return std::bind(function, object, std::placeholders::_1,
-						 std::placeholders::_2,
-						 std::placeholders::_3,
-						 std::placeholders::_4,
-						 std::placeholders::_5,
-						 std::placeholders::_6,
-						 std::placeholders::_7,
-						 std::placeholders::_8,
-						 std::placeholders::_9,
-						 std::placeholders::_10,
-						 std::placeholders::_11,
-						 std::placeholders::_12,
-						 std::placeholders::_13,
-						 std::placeholders::_14,
-						 std::placeholders::_15,
-						 std::placeholders::_16,
-						 std::placeholders::_17,
-						 std::placeholders::_18,
-						 std::placeholders::_19,
-						 std::placeholders::_20,
-						 std::placeholders::_21,
-						 std::placeholders::_22,
-						 std::placeholders::_23);
-	}
+	inline virtual void scan(TickType_t wait) noexcept = 0;
 
 	/**
-	 * @brief Function helper for binding a function with various number of arguments.
-	 * @tparam O The type of object the function is a member of.
-	 * @tparam F The type of function being bound.
-	 * @param object The object instance upon which the function will be bound and called.
-	 * @param function The function being bound.
-	 * @return The object member function in a std::function wrapper.
+	 * @brief A function used to unblock all threads waiting for this event.
 	 */
-	template<typename O, typename F>
-	inline static constexpr std::function<void(Args...)> get(O* object, F&& function) noexcept requires (sizeof...(Args) == 24) {
-		return std::bind(function, object, std::placeholders::_1,
-						 std::placeholders::_2,
-						 std::placeholders::_3,
-						 std::placeholders::_4,
-						 std::placeholders::_5,
-						 std::placeholders::_6,
-						 std::placeholders::_7,
-						 std::placeholders::_8,
-						 std::placeholders::_9,
-						 std::placeholders::_10,
-						 std::placeholders::_11,
-						 std::placeholders::_12,
-						 std::placeholders::_13,
-						 std::placeholders::_14,
-						 std::placeholders::_15,
-						 std::placeholders::_16,
-						 std::placeholders::_17,
-						 std::placeholders::_18,
-						 std::placeholders::_19,
-						 std::placeholders::_20,
-						 std::placeholders::_21,
-						 std::placeholders::_22,
-						 std::placeholders::_23,
-						 std::placeholders::_24);
-	}
+	inline virtual void unblock() noexcept = 0;
 
 	/**
-	 * @brief Function helper for binding a function with various number of arguments.
-	 * @tparam O The type of object the function is a member of.
-	 * @tparam F The type of function being bound.
-	 * @param object The object instance upon which the function will be bound and called.
-	 * @param function The function being bound.
-	 * @return The object member function in a std::function wrapper.
+	 * @return The object owning the handle, responsible for its scanning and lifetime.
 	 */
-	template<typename O, typename F>
-	inline static constexpr std::function<void(Args...)> get(O* object, F&& function) noexcept requires (sizeof...(Args) == 25) {
-		return std::bind(function, object, std::placeholders::_1,
-						 std::placeholders::_2,
-						 std::placeholders::_3,
-						 std::placeholders::_4,
-						 std::placeholders::_5,
-						 std::placeholders::_6,
-						 std::placeholders::_7,
-						 std::placeholders::_8,
-						 std::placeholders::_9,
-						 std::placeholders::_10,
-						 std::placeholders::_11,
-						 std::placeholders::_12,
-						 std::placeholders::_13,
-						 std::placeholders::_14,
-						 std::placeholders::_15,
-						 std::placeholders::_16,
-						 std::placeholders::_17,
-						 std::placeholders::_18,
-						 std::placeholders::_19,
-						 std::placeholders::_20,
-						 std::placeholders::_21,
-						 std::placeholders::_22,
-						 std::placeholders::_23,
-						 std::placeholders::_24,
-						 std::placeholders::_25);
-	}
+	inline virtual  Object* getOwningObject() const noexcept { return nullptr; }
 
 	/**
-	 * @brief Function helper for binding a function with various number of arguments.
-	 * @tparam O The type of object the function is a member of.
-	 * @tparam F The type of function being bound.
-	 * @param object The object instance upon which the function will be bound and called.
-	 * @param function The function being bound.
-	 * @return The object member function in a std::function wrapper.
+	 * @return The priority with which the handle is scanned relative to the other ready handles of its owner.
 	 */
-	template<typename O, typename F>
-	inline static constexpr std::function<void(Args...)> get(O* object, F&& function) noexcept requires (sizeof...(Args) == 26) {
-		return std::bind(function, object, std::placeholders::_1,
-						 std::placeholders::_2,
-						 std::placeholders::_3,
-						 std::placeholders::_4,
-						 std::placeholders::_5,
-						 std::placeholders::_6,
-						 std::placeholders::_7,
-						 std::placeholders::_8,
-						 std::placeholders::_9,
-						 std::placeholders::_10,
-						 std::placeholders::_11,
-						 std::placeholders::_12,
-						 std::placeholders::_13,
-						 std::placeholders::_14,
-						 std::placeholders::_15,
-						 std::placeholders::_16,
-						 std::placeholders::_17,
-						 std::placeholders::_18,
-						 std::placeholders::_19,
-						 std::placeholders::_20,
-						 std::placeholders::_21,
-						 std::placeholders::_22,
-						 std::placeholders::_23,
-						 std::placeholders::_24,
-						 std::placeholders::_25,
-						 std::placeholders::_26);
-	}
+	inline EventPriority getPriority() const noexcept { return priority; }
 
 	/**
-	 * @brief Function helper for binding a function with various number of arguments.
-	 * @tparam O The type of object the function is a member of.
-	 * @tparam F The type of function being bound.
-	 * @param object The object instance upon which the function will be bound and called.
-	 * @param function The function being bound.
-	 * @return The object member function in a std::function wrapper.
+	 * @param value The priority with which the handle is scanned relative to the other ready handles of its owner.
 	 */
-	template<typename O, typename F>
-	inline static constexpr std::function<void(Args...)> get(O* object, F&& function) noexcept requires (sizeof...(Args) == 27) {
-		return std::bind(function, object, std::placeholders::_1,
-						 std::placeholders::_2,
-						 std::placeholders::_3,
-						 std::placeholders::_4,
-						 std::placeholders::_5,
-						 std::placeholders::_6,
-						 std::placeholders::_7,
-						 std::placeholders::_8,
-						 std::placeholders::_9,
-						 std::placeholders::_10,
-						 std::placeholders::_11,
-						 std::placeholders::_12,
-						 std::placeholders::_13,
-						 std::placeholders::_14,
-						 std::placeholders::_15,
-						 std::placeholders::_16,
-						 std::placeholders::_17,
-						 std::placeholders::_18,
-						 std::placeholders::_19,
-						 std::placeholders::_20,
-						 std::placeholders::_21,
-						 std::placeholders::_22,
-						 std::placeholders::_23,
-						 std::placeholders::_24,
-						 std::placeholders::_25,
-						 std::placeholders::_26,
-						 std::placeholders::_27);
-	}
+	inline void setPriority(EventPriority value) noexcept { priority = value; }
 
 	/**
-	 * @brief Function helper for binding a function with various number of arguments.
-	 * @tparam O The type of object the function is a member of.
-	 * @tparam F The type of function being bound.
-	 * @param object The object instance upon which the function will be bound and called.
-	 * @param function The function being bound.
-	 * @return The object member function in a std::function wrapper.
+	 * @brief Keeps the handle from being deleted by release() until the matching release, while it is in use by a task other than its event.
 	 */
-	template<typename O, typename F>
-	inline static constexpr std::function<void(Args...)> get(O* object, F&& function) noexcept requires (sizeof...(Args) == 28) {
-		return std::bind(function, object, std::placeholders::_1,
-						 std::placeholders::_2,
-						 std::placeholders::_3,
-						 std::placeholders::_4,
-						 std::placeholders::_5,
-						 std::placeholders::_6,
-						 std::placeholders::_7,
-						 std::placeholders::_8,
-						 std::placeholders::_9,
-						 std::placeholders::_10,
-						 std::placeholders::_11,
-						 std::placeholders::_12,
-						 std::placeholders::_13,
-						 std::placeholders::_14,
-						 std::placeholders::_15,
-						 std::placeholders::_16,
-						 std::placeholders::_17,
-						 std::placeholders::_18,
-						 std::placeholders::_19,
-						 std::placeholders::_20,
-						 std::placeholders::_21,
-						 std::placeholders::_22,
-						 std::placeholders::_23,
-						 std::placeholders::_24,
-						 std::placeholders::_25,
-						 std::placeholders::_26,
-						 std::placeholders::_27,
-						 std::placeholders::_28);
-	}
+	inline void retain() noexcept { references.fetch_add(1, std::memory_order_relaxed); }
 
 	/**
-	 * @brief Function helper for binding a function with various number of arguments.
-	 * @tparam O The type of object the function is a member of.
-	 * @tparam F The type of function being bound.
-	 * @param object The object instance upon which the function will be bound and called.
-	 * @param function The function being bound.
-	 * @return The object member function in a std::function wrapper.
+	 * @brief Drops a reference taken with retain(), or the one the handle starts with, deleting the handle once none are left.
 	 */
-	template<typename O, typename F>
-	inline static constexpr std::function<void(Args...)> get(O* object, F&& function) noexcept requires (sizeof...(Args) == 29) {
-		return std::bind(function, object, std::placeholders::_1,
-						 std::placeholders::_2,
-						 std::placeholders::_3,
-						 std::placeholders::_4,
-						 std::placeholders::_5,
-						 std::placeholders::_6,
-						 std::placeholders::_7,
-						 std::placeholders::_8,
-						 std::placeholders::_9,
-						 std::placeholders::_10,
-						 std::placeholders::_11,
-						 std::placeholders::_12,
-						 std::placeholders::_13,
-						 std::placeholders::_14,
-						 std::placeholders::_15,
-						 std::placeholders::_16,
-						 std::placeholders::_17,
-						 std::placeholders::_18,
-						 std::placeholders::_19,
-						 std::placeholders::_20,
-						 std::placeholders::_21,
-						 std::placeholders::_22,
-						 std::placeholders::_23,
-						 std::placeholders::_24,
-						 std::placeholders::_25,
-						 std::placeholders::_26,
-						 std::placeholders::_27,
-						 std::placeholders::_28,
-						 std::placeholders::_29);
+	inline void release() noexcept {
+		if(references.fetch_sub(1, std::memory_order_acq_rel) == 1){
+			delete this;
+		}
 	}
 
 private:
-	/**
-	 * @brief Deleted constructor to ensure static use of the class.
-	 */
-	inline BindHelper() noexcept = delete;
+	EventPriority priority = EventPriority::Normal;
+	std::atomic_uint32_t references = 1; // The first one is held by the event the handle is bound to, the others by scans in progress
 };
 
 /**
- * @brief A helper static class used to call bound object member functions by passing arguments in a form of std::tuple.
- * @tparam Args The types of arguments passed when the function is called.
+ * @brief The type of queue an event handle keeps its pending calls in.
+ * Locking is a resizable queue which any number of threads can push into.
+ * MPSC is a fixed capacity queue which the owner reads from without locking. Calls from different tasks, such as broadcasts of several events,
+ * the EventTimer or the EventReplayer, each reserve their own slot with a compare-and-swap, so a caller never waits for another one.
+ * Latest keeps only the newest pending call, each call replaces the pending one instead of queueing behind it.
+ * Meant for high rate producers such as sensor readings, where the callback only needs the current value.
  */
-template<typename ...Args>
-struct CallHelper {
-	/**
-	 * @brief Function variation which ensures proper error logging in event a function with more than 29 arguments is attempted to be called.
-	 * @param function The function in a std::function wrapper being called.
-	 * @param arguments The arguments in a std::tuple being passed as individual arguments to the function.
-	 * @return Always false.
-	 */
-	inline static constexpr bool call(const std::function<void(Args...)>& function, const std::tuple<Args...>& arguments) noexcept {
-		CMF_LOG(CMF, Error, "Unsupported call attempted on a function with more than 31 argument.");
-		return false;
-	}
-
-	/**
-	 * @brief A helper function used to call a function with arguments contained in a std::tuple.
-	 * @param function The function being called in a std::function wrapper.
-	 * @param arguments The arguments being passed to the function in a std::tuple.
-	 * @return False if function is invalid, true otherwise.
-	 */
-	inline static constexpr bool call(const std::function<void(Args...)>& function, const std::tuple<Args...>& arguments) noexcept requires (sizeof...(Args) == 0) {
-		if(function == nullptr){
-			return false;
-		}
-
-		function();
-
-		return true;
-	}
-
-	/**
-	 * @brief A helper function used to call a function with arguments contained in a std::tuple.
-	 * @param function The function being called in a std::function wrapper.
-	 * @param arguments The arguments being passed to the function in a std::tuple.
-	 * @return False if function is invalid, true otherwise.
-	 */
-	inline static constexpr bool call(const std::function<void(Args...)>& function, const std::tuple<Args...>& arguments) noexcept requires (sizeof...(Args) == 1) {
-		if(function == nullptr){
-			return false;
-		}
-
-		function(std::get<0>(arguments));
-
-		return true;
-	}
-
-	/**
-	 * @brief A helper function used to call a function with arguments contained in a std::tuple.
-	 * @param function The function being called in a std::function wrapper.
-	 * @param arguments The arguments being passed to the function in a std::tuple.
-	 * @return False if function is invalid, true otherwise.
-	 */
-	inline static constexpr bool call(const std::function<void(Args...)>& function, const std::tuple<Args...>& arguments) noexcept requires (sizeof...(Args) == 2) {
-		if(function == nullptr){
-			return false;
-		}
-
-		function(std::get<0>(arguments),
-				 std::get<1>(arguments));
-
-		return true;
-	}
-
-	/**
-	 * @brief A helper function used to call a function with arguments contained in a std::tuple.
-	 * @param function The function being called in a std::function wrapper.
-	 * @param arguments The arguments being passed to the function in a std::tuple.
-	 * @return False if function is invalid, true otherwise.
-	 */
-	inline static constexpr bool call(const std::function<void(Args...)>& function, const std::tuple<Args...>& arguments) noexcept requires (sizeof...(Args) == 3) {
-		if(function == nullptr){
-			return false;
-		}
-
-		function(std::get<0>(arguments),
-				 std::get<1>(arguments),
-				 std::get<2>(arguments));
-
-		return true;
-	}
-
-	/**
-	 * @brief A helper function used to call a function with arguments contained in a std::tuple.
-	 * @param function The function being called in a std::function wrapper.
-	 * @param arguments The arguments being passed to the function in a std::tuple.
-	 * @return False if function is invalid, true otherwise.
-	 */
-	inline static constexpr bool call(const std::function<void(Args...)>& function, const std::tuple<Args...>& arguments) noexcept requires (sizeof...(Args) == 4) {
-		if(function == nullptr){
-			return false;
-		}
-
-		function(std::get<0>(arguments),
-				 std::get<1>(arguments),
-				 std::get<2>(arguments),
-				 std::get<3>(arguments));
-
-		return true;
-	}
-
-	/**
-	 * @brief A helper function used to call a function with arguments contained in a std::tuple.
-	 * @param function The function being called in a std::function wrapper.
-	 * @param arguments The arguments being passed to the function in a std::tuple.
-	 * @return False if function is invalid, true otherwise.
-	 */
-	inline static constexpr bool call(const std::function<void(Args...)>& function, const std::tuple<Args...>& arguments) noexcept requires (sizeof...(Args) == 5) {
-		if(function == nullptr){
-			return false;
-		}
-
-		function(std::get<0>(arguments),
-				 std::get<1>(arguments),
-				 std::get<2>(arguments),
-				 std::get<3>(arguments),
-				 std::get<4>(arguments));
-
-		return true;
-	}
-
-	/**
-	 * @brief A helper function used to call a function with arguments contained in a std::tuple.
-	 * @param function The function being called in a std::function wrapper.
-	 * @param arguments The arguments being passed to the function in a std::tuple.
-	 * @return False if function is invalid, true otherwise.
-	 */
-	inline static constexpr bool call(const std::function<void(Args...)>& function, const std::tuple<Args...>& arguments) noexcept requires (sizeof...(Args) == 6) {
-		if(function == nullptr){
-			return false;
-		}
-
-		function(std::get<0>(arguments),
-				 std::get<1>(arguments),
-				 std::get<2>(arguments),
-				 std::get<3>(arguments),
-				 std::get<4>(arguments),
-				 std::get<5>(arguments));
-
-		return true;
-	}
-
-	/**
-	 * @brief A helper function used to call a function with arguments contained in a std::tuple.
-	 * @param function The function being called in a std::function wrapper.
-	 * @param arguments The arguments being passed to the function in a std::tuple.
-	 * @return False if function is invalid, true otherwise.
-	 */
-	inline static constexpr bool call(const std::function<void(Args...)>& function, const std::tuple<Args...>& arguments) noexcept requires (sizeof...(Args) == 7) {
-		if(function == nullptr){
-			return false;
-		}
+enum class EventQueueType : uint8_t {
+	Locking,
+	MPSC,
+	Latest
+};
 
-		function(std::get<0>(arguments),
-				 std::get<1>(arguments),
-				 std::get<2>(arguments),
-				 std::get<3>(arguments),
-				 std::get<4>(arguments),
-				 std::get<5>(arguments),
-				 std::get<6>(arguments));
+#ifdef CONFIG_CMF_EVENT_MPSC_QUEUE_DEFAULT
+static constexpr EventQueueType DefaultEventQueueType = EventQueueType::MPSC;
+#else
+static constexpr EventQueueType DefaultEventQueueType = EventQueueType::Locking;
+#endif
 
-		return true;
-	}
+/**
+ * @brief How an event handle delivers calls to its callback.
+ * Queued always queues the call, and the callback is called during the next scan of the owner.
+ * SameThread calls the callback directly inside the call when it comes from the task scanning the events of the owner, and queues calls from other tasks.
+ * Immediate always calls the callback directly, on the calling task, so the callback has to be safe to run on any task that broadcasts.
+ * Direct calls are only made when no queued calls are pending, so the callback still receives the calls in order.
+ */
+enum class EventDispatch : uint8_t {
+	Queued,
+	SameThread,
+	Immediate
+};
 
-	/**
-	 * @brief A helper function used to call a function with arguments contained in a std::tuple.
-	 * @param function The function being called in a std::function wrapper.
-	 * @param arguments The arguments being passed to the function in a std::tuple.
-	 * @return False if function is invalid, true otherwise.
-	 */
-	inline static constexpr bool call(const std::function<void(Args...)>& function, const std::tuple<Args...>& arguments) noexcept requires (sizeof...(Args) == 8) {
-		if(function == nullptr){
-			return false;
-		}
+#ifdef CONFIG_CMF_EVENT_SAME_THREAD_DISPATCH_DEFAULT
+static constexpr EventDispatch DefaultEventDispatch = EventDispatch::SameThread;
+#else
+static constexpr EventDispatch DefaultEventDispatch = EventDispatch::Queued;
+#endif
 
-		function(std::get<0>(arguments),
-				 std::get<1>(arguments),
-				 std::get<2>(arguments),
-				 std::get<3>(arguments),
-				 std::get<4>(arguments),
-				 std::get<5>(arguments),
-				 std::get<6>(arguments),
-				 std::get<7>(arguments));
+/**
+ * @brief What an event handle does with a call when its queue is full.
+ * Grow resizes the queue on the heap, up to the limit if one is set. MPSC queues can not grow, so they discard the new call.
+ * DropNewest discards the new call.
+ * DropOldest discards the oldest pending call to make room. MPSC queues can only be emptied by their consumer, so they discard the new call instead.
+ * Block makes the caller wait for room, up to the timeout, after which the new call is discarded.
+ * Calls from the task scanning the owner are never blocked, since the room could only be made by that same task.
+ * Latest queues never overflow.
+ */
+enum class EventOverflowPolicy : uint8_t {
+	Grow,
+	DropNewest,
+	DropOldest,
+	Block
+};
 
-		return true;
-	}
+/**
+ * @brief Overflow behavior of the queue of an event handle. All discarded calls are counted by the handle.
+ */
+struct EventOverflow {
+	EventOverflowPolicy policy = EventOverflowPolicy::Grow;
+	size_t limit = 0; // Maximum number of pending calls, 0 is unlimited for Grow and the initial queue capacity for the other policies
+	TickType_t timeout = 0; // Maximum time a call waits for room with the Block policy
+};
 
+/**
+ * @brief Event handle implementation with custom argument types.
+ * @tparam Args The types of arguments being broadcast to the callback functions.
+ */
+template<typename ...Args>
+class EventHandle : public EventHandleBase {
+public:
 	/**
-	 * @brief A helper function used to call a function with arguments contained in a std::tuple.
-	 * @param function The function being called in a std::function wrapper.
-	 * @param arguments The arguments being passed to the function in a std::tuple.
-	 * @return False if function is invalid, true otherwise.
+	 * @brief The pending calls passed to a batched callback at once, oldest first.
 	 */
-	inline static constexpr bool call(const std::function<void(Args...)>& function, const std::tuple<Args...>& arguments) noexcept requires (sizeof...(Args) == 9) {
-		if(function == nullptr){
-			return false;
-		}
-
-		function(std::get<0>(arguments),
-				 std::get<1>(arguments),
-				 std::get<2>(arguments),
-				 std::get<3>(arguments),
-				 std::get<4>(arguments),
-				 std::get<5>(arguments),
-				 std::get<6>(arguments),
-				 std::get<7>(arguments),
-				 std::get<8>(arguments));
-
-		return true;
-	}
+	using Batch = std::span<const std::tuple<Args...>>;
 
 	/**
-	 * @brief A helper function used to call a function with arguments contained in a std::tuple.
-	 * @param function The function being called in a std::function wrapper.
-	 * @param arguments The arguments being passed to the function in a std::tuple.
-	 * @return False if function is invalid, true otherwise.
+	 * @brief Constructor with the option of selecting the type of the call queue and how calls are delivered.
+	 * @param queueType The type of queue pending event calls are kept in.
+	 * @param dispatch How calls are delivered to the callback.
 	 */
-	inline static constexpr bool call(const std::function<void(Args...)>& function, const std::tuple<Args...>& arguments) noexcept requires (sizeof...(Args) == 10) {
-		if(function == nullptr){
-			return false;
-		}
-
-		function(std::get<0>(arguments),
-				 std::get<1>(arguments),
-				 std::get<2>(arguments),
-				 std::get<3>(arguments),
-				 std::get<4>(arguments),
-				 std::get<5>(arguments),
-				 std::get<6>(arguments),
-				 std::get<7>(arguments),
-				 std::get<8>(arguments),
-				 std::get<9>(arguments));
-
-		return true;
-	}
+	inline explicit EventHandle(EventQueueType queueType = DefaultEventQueueType, EventDispatch dispatch = DefaultEventDispatch) noexcept :
+			dispatch(dispatch), callQueue(makeCallQueue(queueType)) {}
 
 	/**
-	 * @brief A helper function used to call a function with arguments contained in a std::tuple.
-	 * @param function The function being called in a std::function wrapper.
-	 * @param arguments The arguments being passed to the function in a std::tuple.
-	 * @return False if function is invalid, true otherwise.
+	 * @brief Destructor unregisters this event handle from the owning object, stopping its scanning.
 	 */
-	inline static constexpr bool call(const std::function<void(Args...)>& function, const std::tuple<Args...>& arguments) noexcept requires (sizeof...(Args) == 11) {
-		if(function == nullptr){
-			return false;
+	inline virtual ~EventHandle() noexcept override {
+		// Detached handles were unregistered already, and may outlive their owner until they are freed
+		if(!detached.load(std::memory_order_acquire)){
+			unregister();
 		}
-
-		function(std::get<0>(arguments),
-				 std::get<1>(arguments),
-				 std::get<2>(arguments),
-				 std::get<3>(arguments),
-				 std::get<4>(arguments),
-				 std::get<5>(arguments),
-				 std::get<6>(arguments),
-				 std::get<7>(arguments),
-				 std::get<8>(arguments),
-				 std::get<9>(arguments),
-				 std::get<10>(arguments));
-
-		return true;
 	}
 
 	/**
-	 * @brief A helper function used to call a function with arguments contained in a std::tuple.
-	 * @param function The function being called in a std::function wrapper.
-	 * @param arguments The arguments being passed to the function in a std::tuple.
-	 * @return False if function is invalid, true otherwise.
+	 * @return The object owning the handle, responsible for its scanning and lifetime.
 	 */
-	inline static constexpr bool call(const std::function<void(Args...)>& function, const std::tuple<Args...>& arguments) noexcept requires (sizeof...(Args) == 12) {
-		if(function == nullptr){
-			return false;
-		}
-
-		function(std::get<0>(arguments),
-				 std::get<1>(arguments),
-				 std::get<2>(arguments),
-				 std::get<3>(arguments),
-				 std::get<4>(arguments),
-				 std::get<5>(arguments),
-				 std::get<6>(arguments),
-				 std::get<7>(arguments),
-				 std::get<8>(arguments),
-				 std::get<9>(arguments),
-				 std::get<10>(arguments),
-				 std::get<11>(arguments));
-
-		return true;
+	virtual Object* getOwningObject() const noexcept override {
+		return *owningObject;
 	}
 
 	/**
-	 * @brief A helper function used to call a function with arguments contained in a std::tuple.
-	 * @param function The function being called in a std::function wrapper.
-	 * @param arguments The arguments being passed to the function in a std::tuple.
-	 * @return False if function is invalid, true otherwise.
+	 * @brief Bind function binds a member function of an object type instance to the event as a callback.
+	 * @tparam O The type of object the function is a member of.
+	 * @tparam F The type of function being bound.
+	 * @param object The instance of object owning the function.
+	 * @param function The function reference being bound.
+	 * @param priority The priority with which the handle is scanned relative to the other ready handles of its owner.
+	 * @return Reference to this.
 	 */
-	inline static constexpr bool call(const std::function<void(Args...)>& function, const std::tuple<Args...>& arguments) noexcept requires (sizeof...(Args) == 13) {
-		if(function == nullptr){
-			return false;
-		}
-
-		function(std::get<0>(arguments),
-				 std::get<1>(arguments),
-				 std::get<2>(arguments),
-				 std::get<3>(arguments),
-				 std::get<4>(arguments),
-				 std::get<5>(arguments),
-				 std::get<6>(arguments),
-				 std::get<7>(arguments),
-				 std::get<8>(arguments),
-				 std::get<9>(arguments),
-				 std::get<10>(arguments),
-				 std::get<11>(arguments),
-				 std::get<12>(arguments));
-
-		return true;
+	template<typename O, typename F> requires std::is_member_function_pointer_v<std::remove_cvref_t<F>>
+	inline EventHandle& bind(O* object, F&& function, EventPriority priority = EventPriority::Normal) noexcept {
+		return bindCallback(object, EventCallback<Args...>(object, std::forward<F>(function)), priority);
 	}
 
 	/**
-	 * @brief A helper function used to call a function with arguments contained in a std::tuple.
-	 * @param function The function being called in a std::function wrapper.
-	 * @param arguments The arguments being passed to the function in a std::tuple.
-	 * @return False if function is invalid, true otherwise.
+	 * @brief Bind function binds a callable, such as a lambda or a std::function, to the event as a callback paired with the owning object instance.
+	 * @tparam O The type of object owning the callback.
+	 * @tparam F The type of callable being bound, stored inside the handle without allocating.
+	 * @param object The instance of object owning the callback.
+	 * @param function The callable being bound.
+	 * @param priority The priority with which the handle is scanned relative to the other ready handles of its owner.
+	 * @return Reference to this.
 	 */
-	inline static constexpr bool call(const std::function<void(Args...)>& function, const std::tuple<Args...>& arguments) noexcept requires (sizeof...(Args) == 14) {
-		if(function == nullptr){
-			return false;
-		}
-
-		function(std::get<0>(arguments),
-				 std::get<1>(arguments),
-				 std::get<2>(arguments),
-				 std::get<3>(arguments),
-				 std::get<4>(arguments),
-				 std::get<5>(arguments),
-				 std::get<6>(arguments),
-				 std::get<7>(arguments),
-				 std::get<8>(arguments),
-				 std::get<9>(arguments),
-				 std::get<10>(arguments),
-				 std::get<11>(arguments),
-				 std::get<12>(arguments),
-				 std::get<13>(arguments));
-
-		return true;
+	template<typename O, typename F> requires (!std::is_member_function_pointer_v<std::remove_cvref_t<F>> && std::constructible_from<EventCallback<Args...>, F>)
+	inline EventHandle& bind(O* object, F&& function, EventPriority priority = EventPriority::Normal) noexcept {
+		return bindCallback(object, EventCallback<Args...>(std::forward<F>(function)), priority);
 	}
 
 	/**
-	 * @brief A helper function used to call a function with arguments contained in a std::tuple.
-	 * @param function The function being called in a std::function wrapper.
-	 * @param arguments The arguments being passed to the function in a std::tuple.
-	 * @return False if function is invalid, true otherwise.
+	 * @brief Binds a batched callback, which is called once per scan with all calls pending at that moment, instead of once per call.
+	 * Suits consumers such as loggers or sample aggregators, which can process a whole burst at once.
+	 * Replaces the per call callback, a handle has only one of the two.
+	 * @tparam O The type of object owning the callback.
+	 * @tparam F The type of member function of O, or callable, taking a Batch.
+	 * @param object The instance of object owning the callback.
+	 * @param function The member function or callable being bound.
+	 * @param priority The priority with which the handle is scanned relative to the other ready handles of its owner.
+	 * @return Reference to this.
 	 */
-	inline static constexpr bool call(const std::function<void(Args...)>& function, const std::tuple<Args...>& arguments) noexcept requires (sizeof...(Args) == 15) {
-		if(function == nullptr){
-			return false;
+	template<typename O, typename F>
+	inline EventHandle& bindBatch(O* object, F&& function, EventPriority priority = EventPriority::Normal) noexcept {
+		if constexpr(std::is_member_function_pointer_v<std::remove_cvref_t<F>>){
+			batchCallback = EventCallback<Batch>(object, std::forward<F>(function));
+		}else{
+			batchCallback = EventCallback<Batch>(std::forward<F>(function));
 		}
 
-		function(std::get<0>(arguments),
-				 std::get<1>(arguments),
-				 std::get<2>(arguments),
-				 std::get<3>(arguments),
-				 std::get<4>(arguments),
-				 std::get<5>(arguments),
-				 std::get<6>(arguments),
-				 std::get<7>(arguments),
-				 std::get<8>(arguments),
-				 std::get<9>(arguments),
-				 std::get<10>(arguments),
-				 std::get<11>(arguments),
-				 std::get<12>(arguments),
-				 std::get<13>(arguments),
-				 std::get<14>(arguments));
+		callback = nullptr;
 
-		return true;
+		return attach(object, priority);
 	}
 
 	/**
-	 * @brief A helper function used to call a function with arguments contained in a std::tuple.
-	 * @param function The function being called in a std::function wrapper.
-	 * @param arguments The arguments being passed to the function in a std::tuple.
-	 * @return False if function is invalid, true otherwise.
+	 * @brief Call function queues an argument std::tuple into the call queue for the callback functions to be called with in the next scan call,
+	 * and readies the handle on the outermost owner of its owning object.
+	 * With the Latest queue type the call replaces the pending one, and the handle is only readied when no call was pending.
+	 * Depending on the dispatch of the handle, the callback may instead be called directly, before this function returns.
+	 * Calls are discarded once the owning object is not valid anymore.
+	 * @param args The arguments for the next event call.
+	 * @return True if successful, false otherwise.
 	 */
-	inline static constexpr bool call(const std::function<void(Args...)>& function, const std::tuple<Args...>& arguments) noexcept requires (sizeof...(Args) == 16) {
-		if(function == nullptr){
-			return false;
+	inline bool call(const Args&... args) noexcept {
+		if(detached.load(std::memory_order_acquire)){
+			return true;
 		}
 
-		function(std::get<0>(arguments),
-				 std::get<1>(arguments),
-				 std::get<2>(arguments),
-				 std::get<3>(arguments),
-				 std::get<4>(arguments),
-				 std::get<5>(arguments),
-				 std::get<6>(arguments),
-				 std::get<7>(arguments),
-				 std::get<8>(arguments),
-				 std::get<9>(arguments),
-				 std::get<10>(arguments),
-				 std::get<11>(arguments),
-				 std::get<12>(arguments),
-				 std::get<13>(arguments),
-				 std::get<14>(arguments),
-				 std::get<15>(arguments));
-
-		return true;
-	}
+		// The owner can be deleted by another task at any time, the pin keeps it alive until the handle is readied on it
+		const ObjectPin<Object> owningObjectPin = owningObject.pin();
+		if(!owningObjectPin){
+			return true;
+		}
 
-	/**
-	 * @brief A helper function used to call a function with arguments contained in a std::tuple.
-	 * @param function The function being called in a std::function wrapper.
-	 * @param arguments The arguments being passed to the function in a std::tuple.
-	 * @return False if function is invalid, true otherwise.
-	 */
-	inline static constexpr bool call(const std::function<void(Args...)>& function, const std::tuple<Args...>& arguments) noexcept requires (sizeof...(Args) == 17) {
-		if(function == nullptr){
-			return false;
+		Object* owner = owningObjectPin.get();
+		if(Object* outermostOwner = owner->getOutermostOwner()){
+			owner = outermostOwner;
 		}
 
-		function(std::get<0>(arguments),
-				 std::get<1>(arguments),
-				 std::get<2>(arguments),
-				 std::get<3>(arguments),
-				 std::get<4>(arguments),
-				 std::get<5>(arguments),
-				 std::get<6>(arguments),
-				 std::get<7>(arguments),
-				 std::get<8>(arguments),
-				 std::get<9>(arguments),
-				 std::get<10>(arguments),
-				 std::get<11>(arguments),
-				 std::get<12>(arguments),
-				 std::get<13>(arguments),
-				 std::get<14>(arguments),
-				 std::get<15>(arguments),
-				 std::get<16>(arguments));
+		if(dispatch != EventDispatch::Queued && callDirectly(owner, args...)){
+			return true;
+		}
 
-		return true;
-	}
+		if(LatestCallSlot* slot = std::get_if<LatestCallSlot>(&callQueue)){
+			// Only the call filling an empty slot readies the handle, later ones replace the pending call which is already waiting to be scanned
+			const bool filled = slot->store(std::tuple<Args...>(args...));
+			stats.recordCall([]{ return 1; });
 
-	/**
-	 * @brief A helper function used to call a function with arguments contained in a std::tuple.
-	 * @param function The function being called in a std::function wrapper.
-	 * @param arguments The arguments being passed to the function in a std::tuple.
-	 * @return False if function is invalid, true otherwise.
-	 */
-	inline static constexpr bool call(const std::function<void(Args...)>& function, const std::tuple<Args...>& arguments) noexcept requires (sizeof...(Args) == 18) {
-		if(function == nullptr){
+			if(!filled){
+				stats.recordDrop();
+				return true;
+			}
+		}else if(enqueue(owner, std::tuple<Args...>(args...))){
+			stats.recordCall([this]{ return std::visit([](const auto& queue){ return queue.size(); }, callQueue); });
+		}else{
+			overflowDrops.fetch_add(1, std::memory_order_relaxed);
+			stats.recordPushFailure();
 			return false;
 		}
 
-		function(std::get<0>(arguments),
-				 std::get<1>(arguments),
-				 std::get<2>(arguments),
-				 std::get<3>(arguments),
-				 std::get<4>(arguments),
-				 std::get<5>(arguments),
-				 std::get<6>(arguments),
-				 std::get<7>(arguments),
-				 std::get<8>(arguments),
-				 std::get<9>(arguments),
-				 std::get<10>(arguments),
-				 std::get<11>(arguments),
-				 std::get<12>(arguments),
-				 std::get<13>(arguments),
-				 std::get<14>(arguments),
-				 std::get<15>(arguments),
-				 std::get<16>(arguments),
-				 std::get<17>(arguments));
+		// Readying the handle directly means a call costs O(1), instead of the scanner probing every handle in the application
+		owner->readyEventHandle(this);
+
+		// Pairs with the fence in detach, either detach finds the handle readied, or this finds the handle detached and takes it back
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if(detached.load(std::memory_order_relaxed)){
+			owner->unregisterEventHandle(this);
+		}
 
 		return true;
 	}
 
 	/**
-	 * @brief A helper function used to call a function with arguments contained in a std::tuple.
-	 * @param function The function being called in a std::function wrapper.
-	 * @param arguments The arguments being passed to the function in a std::tuple.
-	 * @return False if function is invalid, true otherwise.
+	 * @brief Stops the handle for good, while broadcasts which are still running may call it. Used by the event when unbinding it.
+	 * The handle is unregistered from its owner and its pending calls are discarded before this returns, later calls are ignored,
+	 * and a scan in progress stops before its next callback. A callback which is already running on another task still finishes.
+	 * Only freeing the handle is left for later, once no broadcast or scan can reach it anymore.
 	 */
-	inline static constexpr bool call(const std::function<void(Args...)>& function, const std::tuple<Args...>& arguments) noexcept requires (sizeof...(Args) == 19) {
-		if(function == nullptr){
-			return false;
-		}
+	inline void detach() noexcept {
+		detached.store(true, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
 
-		function(std::get<0>(arguments),
-				 std::get<1>(arguments),
-				 std::get<2>(arguments),
-				 std::get<3>(arguments),
-				 std::get<4>(arguments),
-				 std::get<5>(arguments),
-				 std::get<6>(arguments),
-				 std::get<7>(arguments),
-				 std::get<8>(arguments),
-				 std::get<9>(arguments),
-				 std::get<10>(arguments),
-				 std::get<11>(arguments),
-				 std::get<12>(arguments),
-				 std::get<13>(arguments),
-				 std::get<14>(arguments),
-				 std::get<15>(arguments),
-				 std::get<16>(arguments),
-				 std::get<17>(arguments),
-				 std::get<18>(arguments));
+		unregister();
 
-		return true;
+		// The lock-free queue can only be emptied by its consumer, so its calls are dropped by the destructor instead
+		if(LockingCallQueue* queue = std::get_if<LockingCallQueue>(&callQueue)){
+			queue->clear();
+		}else if(LatestCallSlot* slot = std::get_if<LatestCallSlot>(&callQueue)){
+			std::tuple<Args...> discarded;
+			slot->pop(discarded, 0);
+		}
 	}
 
 	/**
-	 * @brief A helper function used to call a function with arguments contained in a std::tuple.
-	 * @param function The function being called in a std::function wrapper.
-	 * @param arguments The arguments being passed to the function in a std::tuple.
-	 * @return False if function is invalid, true otherwise.
+	 * @brief Function probes for if an event call has been queued and is ready to trigger.
+	 * @param wait The maximum wait time for the probing to succeed.
+	 * @return True if there is a queued event call, false otherwise.
 	 */
-	inline static constexpr bool call(const std::function<void(Args...)>& function, const std::tuple<Args...>& arguments) noexcept requires (sizeof...(Args) == 20) {
-		if(function == nullptr){
-			return false;
+	inline virtual bool probe(TickType_t wait) noexcept override {
+		// The lock-free queue can only be read by its consumer, so it is not waited on here
+		if(MPSCCallQueue* queue = std::get_if<MPSCCallQueue>(&callQueue)){
+			return !queue->empty();
 		}
 
-		function(std::get<0>(arguments),
-				 std::get<1>(arguments),
-				 std::get<2>(arguments),
-				 std::get<3>(arguments),
-				 std::get<4>(arguments),
-				 std::get<5>(arguments),
-				 std::get<6>(arguments),
-				 std::get<7>(arguments),
-				 std::get<8>(arguments),
-				 std::get<9>(arguments),
-				 std::get<10>(arguments),
-				 std::get<11>(arguments),
-				 std::get<12>(arguments),
-				 std::get<13>(arguments),
-				 std::get<14>(arguments),
-				 std::get<15>(arguments),
-				 std::get<16>(arguments),
-				 std::get<17>(arguments),
-				 std::get<18>(arguments),
-				 std::get<19>(arguments));
+		return std::visit([wait](auto& queue){
+			if(wait == 0){
+				return !queue.empty();
+			}
 
-		return true;
+			std::tuple<Args...> arguments;
+			return queue.front(arguments, wait);
+		}, callQueue);
 	}
 
 	/**
-	 * @brief A helper function used to call a function with arguments contained in a std::tuple.
-	 * @param function The function being called in a std::function wrapper.
-	 * @param arguments The arguments being passed to the function in a std::tuple.
-	 * @return False if function is invalid, true otherwise.
+	 * @brief Scan function triggers a callback for each triggered event call.
+	 * @param wait Maximum wait time for collective calling of all callbacks with all arguments.
+	 * When the time is up, callback triggering will abort even if more events remain.
 	 */
-	inline static constexpr bool call(const std::function<void(Args...)>& function, const std::tuple<Args...>& arguments) noexcept requires (sizeof...(Args) == 21) {
-		if(function == nullptr){
-			return false;
+	inline virtual void scan(TickType_t wait) noexcept override {
+		if(detached.load(std::memory_order_acquire) || !owningObject.isValid() || (!callback && !batchCallback)){
+			return;
 		}
 
-		function(std::get<0>(arguments),
-				 std::get<1>(arguments),
-				 std::get<2>(arguments),
-				 std::get<3>(arguments),
-				 std::get<4>(arguments),
-				 std::get<5>(arguments),
-				 std::get<6>(arguments),
-				 std::get<7>(arguments),
-				 std::get<8>(arguments),
-				 std::get<9>(arguments),
-				 std::get<10>(arguments),
-				 std::get<11>(arguments),
-				 std::get<12>(arguments),
-				 std::get<13>(arguments),
-				 std::get<14>(arguments),
-				 std::get<15>(arguments),
-				 std::get<16>(arguments),
-				 std::get<17>(arguments),
-				 std::get<18>(arguments),
-				 std::get<19>(arguments),
-				 std::get<20>(arguments));
+		stats.recordDispatch();
 
-		return true;
-	}
+		// Calls made from the callbacks below are queued behind the popped ones instead of being called directly ahead of them
+		scanInProgress.store(true, std::memory_order_relaxed);
 
-	/**
-	 * @brief A helper function used to call a function with arguments contained in a std::tuple.
-	 * @param function The function being called in a std::function wrapper.
-	 * @param arguments The arguments being passed to the function in a std::tuple.
-	 * @return False if function is invalid, true otherwise.
-	 */
-	inline static constexpr bool call(const std::function<void(Args...)>& function, const std::tuple<Args...>& arguments) noexcept requires (sizeof...(Args) == 22) {
-		if(function == nullptr){
-			return false;
+		if(batchCallback){
+			scanBatched(wait);
+		}else{
+			scanQueued(wait);
 		}
 
-		function(std::get<0>(arguments),
-				 std::get<1>(arguments),
-				 std::get<2>(arguments),
-				 std::get<3>(arguments),
-				 std::get<4>(arguments),
-				 std::get<5>(arguments),
-				 std::get<6>(arguments),
-				 std::get<7>(arguments),
-				 std::get<8>(arguments),
-				 std::get<9>(arguments),
-				 std::get<10>(arguments),
-				 std::get<11>(arguments),
-				 std::get<12>(arguments),
-				 std::get<13>(arguments),
-				 std::get<14>(arguments),
-				 std::get<15>(arguments),
-				 std::get<16>(arguments),
-				 std::get<17>(arguments),
-				 std::get<18>(arguments),
-				 std::get<19>(arguments),
-				 std::get<20>(arguments),
-				 std::get<21>(arguments));
+		scanInProgress.store(false, std::memory_order_release);
+	}
 
-		return true;
+	/**
+	* @brief  Unblock the queue multithreaded safety to unblock all threads waiting on it.
+	*/
+	inline virtual void unblock() noexcept override {
+		std::visit([](auto& queue){ queue.setKillPill(true); }, callQueue);
 	}
 
 	/**
-	 * @brief A helper function used to call a function with arguments contained in a std::tuple.
-	 * @param function The function being called in a std::function wrapper.
-	 * @param arguments The arguments being passed to the function in a std::tuple.
-	 * @return False if function is invalid, true otherwise.
+	 * @return The type of queue pending event calls are kept in.
 	 */
-	inline static constexpr bool call(const std::function<void(Args...)>& function, const std::tuple<Args...>& arguments) noexcept requires (sizeof...(Args) == 23) {
-		if(function == nullptr){
-			return false;
-		}
-
-		function(std::get<0>(arguments),
-				 std::get<1>(arguments),
-				 std::get<2>(arguments),
-				 std::get<3>(arguments),
-				 std::get<4>(arguments),
-				 std::get<5>(arguments),
-				 std::get<6>(arguments),
-				 std::get<7>(arguments),
-				 std::get<8>(arguments),
-				 std::get<9>(arguments),
-				 std::get<10>(arguments),
-				 std::get<11>(arguments),
-				 std::get<12>(arguments),
-				 std::get<13>(arguments),
-				 std::get<14>(arguments),
-				 std::get<15>(arguments),
-				 std::get<16>(arguments),
-				 std::get<17>(arguments),
-				 std::get<18>(arguments),
-				 std::get<19>(arguments),
-				 std::get<20>(arguments),
-				 std::get<21>(arguments),
-				 std::get<22>(arguments));
-
-		return true;
+	inline EventQueueType getQueueType() const noexcept {
+		return static_cast<EventQueueType>(callQueue.index());
 	}
 
 	/**
-	 * @brief A helper function used to call a function with arguments contained in a std::tuple.
-	 * @param function The function being called in a std::function wrapper.
-	 * @param arguments The arguments being passed to the function in a std::tuple.
-	 * @return False if function is invalid, true otherwise.
+	 * @return The delivery statistics of the handle, all zero unless CONFIG_CMF_EVENT_INSTRUMENTATION is enabled.
 	 */
-	inline static constexpr bool call(const std::function<void(Args...)>& function, const std::tuple<Args...>& arguments) noexcept requires (sizeof...(Args) == 24) {
-		if(function == nullptr){
-			return false;
-		}
-
-		function(std::get<0>(arguments),
-				 std::get<1>(arguments),
-				 std::get<2>(arguments),
-				 std::get<3>(arguments),
-				 std::get<4>(arguments),
-				 std::get<5>(arguments),
-				 std::get<6>(arguments),
-				 std::get<7>(arguments),
-				 std::get<8>(arguments),
-				 std::get<9>(arguments),
-				 std::get<10>(arguments),
-				 std::get<11>(arguments),
-				 std::get<12>(arguments),
-				 std::get<13>(arguments),
-				 std::get<14>(arguments),
-				 std::get<15>(arguments),
-				 std::get<16>(arguments),
-				 std::get<17>(arguments),
-				 std::get<18>(arguments),
-				 std::get<19>(arguments),
-				 std::get<20>(arguments),
-				 std::get<21>(arguments),
-				 std::get<22>(arguments),
-				 std::get<23>(arguments));
-
-		return true;
+	inline const EventStats& getStats() const noexcept {
+		return stats;
 	}
 
 	/**
-	 * @brief A helper function used to call a function with arguments contained in a std::tuple.
-	 * @param function The function being called in a std::function wrapper.
-	 * @param arguments The arguments being passed to the function in a std::tuple.
-	 * @return False if function is invalid, true otherwise.
+	 * @return How calls are delivered to the callback.
 	 */
-	inline static constexpr bool call(const std::function<void(Args...)>& function, const std::tuple<Args...>& arguments) noexcept requires (sizeof...(Args) == 25) {
-		if(function == nullptr){
-			return false;
-		}
-
-		function(std::get<0>(arguments),
-				 std::get<1>(arguments),
-				 std::get<2>(arguments),
-				 std::get<3>(arguments),
-				 std::get<4>(arguments),
-				 std::get<5>(arguments),
-				 std::get<6>(arguments),
-				 std::get<7>(arguments),
-				 std::get<8>(arguments),
-				 std::get<9>(arguments),
-				 std::get<10>(arguments),
-				 std::get<11>(arguments),
-				 std::get<12>(arguments),
-				 std::get<13>(arguments),
-				 std::get<14>(arguments),
-				 std::get<15>(arguments),
-				 std::get<16>(arguments),
-				 std::get<17>(arguments),
-				 std::get<18>(arguments),
-				 std::get<19>(arguments),
-				 std::get<20>(arguments),
-				 std::get<21>(arguments),
-				 std::get<22>(arguments),
-				 std::get<23>(arguments),
-				 std::get<24>(arguments));
-
-		return true;
+	inline EventDispatch getDispatch() const noexcept {
+		return dispatch;
 	}
 
 	/**
-	 * @brief A helper function used to call a function with arguments contained in a std::tuple.
-	 * @param function The function being called in a std::function wrapper.
-	 * @param arguments The arguments being passed to the function in a std::tuple.
-	 * @return False if function is invalid, true otherwise.
+	 * @param value How calls are delivered to the callback.
 	 */
-	inline static constexpr bool call(const std::function<void(Args...)>& function, const std::tuple<Args...>& arguments) noexcept requires (sizeof...(Args) == 26) {
-		if(function == nullptr){
-			return false;
-		}
-
-		function(std::get<0>(arguments),
-				 std::get<1>(arguments),
-				 std::get<2>(arguments),
-				 std::get<3>(arguments),
-				 std::get<4>(arguments),
-				 std::get<5>(arguments),
-				 std::get<6>(arguments),
-				 std::get<7>(arguments),
-				 std::get<8>(arguments),
-				 std::get<9>(arguments),
-				 std::get<10>(arguments),
-				 std::get<11>(arguments),
-				 std::get<12>(arguments),
-				 std::get<13>(arguments),
-				 std::get<14>(arguments),
-				 std::get<15>(arguments),
-				 std::get<16>(arguments),
-				 std::get<17>(arguments),
-				 std::get<18>(arguments),
-				 std::get<19>(arguments),
-				 std::get<20>(arguments),
-				 std::get<21>(arguments),
-				 std::get<22>(arguments),
-				 std::get<23>(arguments),
-				 std::get<24>(arguments),
-				 std::get<25>(arguments));
-
-		return true;
+	inline void setDispatch(EventDispatch value) noexcept {
+		dispatch = value;
 	}
 
 	/**
-	 * @brief A helper function used to call a function with arguments contained in a std::tuple.
-	 * @param function The function being called in a std::function wrapper.
-	 * @param arguments The arguments being passed to the function in a std::tuple.
-	 * @return False if function is invalid, true otherwise.
+	 * @return How the queue of the handle behaves when it is full.
 	 */
-	inline static constexpr bool call(const std::function<void(Args...)>& function, const std::tuple<Args...>& arguments) noexcept requires (sizeof...(Args) == 27) {
-		if(function == nullptr){
-			return false;
-		}
-
-		function(std::get<0>(arguments),
-				 std::get<1>(arguments),
-				 std::get<2>(arguments),
-				 std::get<3>(arguments),
-				 std::get<4>(arguments),
-				 std::get<5>(arguments),
-				 std::get<6>(arguments),
-				 std::get<7>(arguments),
-				 std::get<8>(arguments),
-				 std::get<9>(arguments),
-				 std::get<10>(arguments),
-				 std::get<11>(arguments),
-				 std::get<12>(arguments),
-				 std::get<13>(arguments),
-				 std::get<14>(arguments),
-				 std::get<15>(arguments),
-				 std::get<16>(arguments),
-				 std::get<17>(arguments),
-				 std::get<18>(arguments),
-				 std::get<19>(arguments),
-				 std::get<20>(arguments),
-				 std::get<21>(arguments),
-				 std::get<22>(arguments),
-				 std::get<23>(arguments),
-				 std::get<24>(arguments),
-				 std::get<25>(arguments),
-				 std::get<26>(arguments));
-
-		return true;
+	inline const EventOverflow& getOverflow() const noexcept {
+		return overflow;
 	}
 
 	/**
-	 * @brief A helper function used to call a function with arguments contained in a std::tuple.
-	 * @param function The function being called in a std::function wrapper.
-	 * @param arguments The arguments being passed to the function in a std::tuple.
-	 * @return False if function is invalid, true otherwise.
+	 * @param value How the queue of the handle behaves when it is full. Should be set before the handle receives calls.
 	 */
-	inline static constexpr bool call(const std::function<void(Args...)>& function, const std::tuple<Args...>& arguments) noexcept requires (sizeof...(Args) == 28) {
-		if(function == nullptr){
-			return false;
-		}
-
-		function(std::get<0>(arguments),
-				 std::get<1>(arguments),
-				 std::get<2>(arguments),
-				 std::get<3>(arguments),
-				 std::get<4>(arguments),
-				 std::get<5>(arguments),
-				 std::get<6>(arguments),
-				 std::get<7>(arguments),
-				 std::get<8>(arguments),
-				 std::get<9>(arguments),
-				 std::get<10>(arguments),
-				 std::get<11>(arguments),
-				 std::get<12>(arguments),
-				 std::get<13>(arguments),
-				 std::get<14>(arguments),
-				 std::get<15>(arguments),
-				 std::get<16>(arguments),
-				 std::get<17>(arguments),
-				 std::get<18>(arguments),
-				 std::get<19>(arguments),
-				 std::get<20>(arguments),
-				 std::get<21>(arguments),
-				 std::get<22>(arguments),
-				 std::get<23>(arguments),
-				 std::get<24>(arguments),
-				 std::get<25>(arguments),
-				 std::get<26>(arguments),
-				 std::get<27>(arguments));
-
-		return true;
+	inline void setOverflow(const EventOverflow& value) noexcept {
+		overflow = value;
 	}
 
 	/**
-	 * @brief A helper function used to call a function with arguments contained in a std::tuple.
-	 * @param function The function being called in a std::function wrapper.
-	 * @param arguments The arguments being passed to the function in a std::tuple.
-	 * @return False if function is invalid, true otherwise.
+	 * @return The number of calls dropped, either discarded by the overflow policy, or replaced by a newer call in a Latest queue before they were scanned.
 	 */
-	inline static constexpr bool call(const std::function<void(Args...)>& function, const std::tuple<Args...>& arguments) noexcept requires (sizeof...(Args) == 29) {
-		if(function == nullptr){
-			return false;
+	inline size_t getDroppedCount() const noexcept {
+		size_t dropped = overflowDrops.load(std::memory_order_relaxed);
+		if(const LatestCallSlot* slot = std::get_if<LatestCallSlot>(&callQueue)){
+			dropped += slot->getDropped();
 		}
 
-		function(std::get<0>(arguments),
-				 std::get<1>(arguments),
-				 std::get<2>(arguments),
-				 std::get<3>(arguments),
-				 std::get<4>(arguments),
-				 std::get<5>(arguments),
-				 std::get<6>(arguments),
-				 std::get<7>(arguments),
-				 std::get<8>(arguments),
-				 std::get<9>(arguments),
-				 std::get<10>(arguments),
-				 std::get<11>(arguments),
-				 std::get<12>(arguments),
-				 std::get<13>(arguments),
-				 std::get<14>(arguments),
-				 std::get<15>(arguments),
-				 std::get<16>(arguments),
-				 std::get<17>(arguments),
-				 std::get<18>(arguments),
-				 std::get<19>(arguments),
-				 std::get<20>(arguments),
-				 std::get<21>(arguments),
-				 std::get<22>(arguments),
-				 std::get<23>(arguments),
-				 std::get<24>(arguments),
-				 std::get<25>(arguments),
-				 std::get<26>(arguments),
-				 std::get<27>(arguments),
-				 std::get<28>(arguments));
-
-		return true;
+		return dropped;
 	}
 
 private:
-	/**
-	 * @brief Deleted default constructor ensuring the class can only be used statically.
-	 */
-	inline CallHelper() noexcept = delete;
-};
-
-/**
- * @brief Base event handle interface demanding implementation of probing and scanning functionality from the event handle implementations.
- */
-class EventHandleBase {
-public:
-	/**
-	* @brief Default destructor.
-	*/
-	virtual ~EventHandleBase() = default;
-
-	/**
-	 * @brief A function used to check if an event trigger is queued or not.
-	 * @param wait The wait time for the check.
-	 * @return True if there is a queued event trigger.
-	 */
-	inline virtual bool probe(TickType_t wait) noexcept = 0;
+	// Number of queued event calls popped at once while scanning
+	static constexpr size_t ScanBatchSize = 4;
 
-	/**
-	 * @brief A function used to scan and process callbacks of queued event triggers.
-	 * @param wait The wait time for the queued event pop.
-	 */
-	inline virtual void scan(TickType_t wait) noexcept = 0;
-
-	/**
-	 * @brief A function used to unblock all threads waiting for this event.
-	 */
-	inline virtual void unblock() noexcept = 0;
+	// All queue types keep their storage inline, so creating a handle does not allocate
+	// The alternatives are in the order of EventQueueType
+	using LockingCallQueue = StaticQueue<std::tuple<Args...>, CONFIG_CMF_EVENT_DEFAULT_QUEUE_SIZE, true>;
+	using MPSCCallQueue = MPSCQueue<std::tuple<Args...>, InlineAllocator<std::tuple<Args...>, CONFIG_CMF_EVENT_MPSC_QUEUE_SIZE>>;
+	using LatestCallSlot = LatestValue<std::tuple<Args...>>;
+	using CallQueue = std::variant<LockingCallQueue, MPSCCallQueue, LatestCallSlot>;
 
-	/**
-	 * @return The object owning the handle, responsible for its scanning and lifetime.
-	 */
-	inline virtual  Object* getOwningObject() const noexcept { return nullptr; }
-};
+	WeakObjectPtr<Object> owningObject = nullptr; // Object of which the callback is a member, in case this owning object
+	EventCallback<Args...> callback;
+	EventCallback<Batch> batchCallback;
+	std::vector<std::tuple<Args...>> batchBuffer; // Calls popped for the batched callback, kept between scans so bursts of a similar size do not allocate
+	EventDispatch dispatch;
+	EventOverflow overflow;
+	std::atomic_size_t overflowDrops = 0;
+	std::atomic_bool scanInProgress = false; // Set while the owner is scanning the handle, direct calls are queued meanwhile
+	std::atomic_bool detached = false; // Set once the handle is unbound from its event, after which it only waits to be freed
+	CallQueue callQueue;
+	[[no_unique_address]] EventStats stats; // Empty and never touched unless CONFIG_CMF_EVENT_INSTRUMENTATION is enabled
 
-/**
- * @brief Event handle implementation with custom argument types.
- * @tparam Args The types of arguments being broadcast to the callback functions.
- */
-template<typename ...Args>
-class EventHandle : public EventHandleBase {
-public:
+private:
 	/**
-	 * @brief Destructor unregisters this event handle from the owning object, stopping its scanning.
+	 * @brief Unregisters the handle from the scanner and from the outermost owner of its owning object, stopping its scanning.
 	 */
-	inline virtual ~EventHandle() noexcept override {
+	inline void unregister() noexcept {
 		if(const Application* app = ApplicationStatics::getApplication()){
 			if(EventScanner* scanner = app->getEventScanner()){
 				scanner->unregisterHandle(this);
 			}
 		}
 
-		Object* owningObjectPtr = owningObject.get();
-		if(owningObjectPtr == nullptr) {
+		const ObjectPin<Object> owningObjectPin = owningObject.pin();
+		if(!owningObjectPin){
 			return;
 		}
 
-		if(Object* owner = owningObjectPtr->getOutermostOwner()) {
-			owner->unregisterEventHandle(this);
-		}else {
-			owningObjectPtr->unregisterEventHandle(this);
+		Object* owner = owningObjectPin.get();
+		if(Object* outermostOwner = owner->getOutermostOwner()){
+			owner = outermostOwner;
 		}
+
+		owner->unregisterEventHandle(this);
 	}
 
 	/**
-	 * @return The object owning the handle, responsible for its scanning and lifetime.
+	 * @brief Registers the handle with the outermost owner of the given object, replacing its previous owner and callback.
+	 * @param object The object owning the callback.
+	 * @param function The callback being bound.
+	 * @param priority The priority with which the handle is scanned relative to the other ready handles of its owner.
+	 * @return Reference to this.
 	 */
-	virtual Object* getOwningObject() const noexcept override {
-		return *owningObject;
+	inline EventHandle& bindCallback(Object* object, EventCallback<Args...>&& function, EventPriority priority) noexcept {
+		callback = std::move(function);
+		batchCallback = nullptr;
+
+		return attach(object, priority);
 	}
 
 	/**
-	 * @brief Bind function binds a member function of an object type instance to the event as a callback.
-	 * @tparam O The type of object the function is a member of.
-	 * @tparam F The type of function being bound.
-	 * @param object The instance of object owning the function.
-	 * @param function The function reference being bound.
+	 * @brief Registers the handle with the outermost owner of the given object, after unregistering it from the previous one.
+	 * @param object The object owning the callback.
+	 * @param priority The priority with which the handle is scanned relative to the other ready handles of its owner.
 	 * @return Reference to this.
 	 */
-	template<typename O, typename F>
-	inline EventHandle& bind(O* object, F&& function) noexcept {
+	inline EventHandle& attach(Object* object, EventPriority priority) noexcept {
 		if(owningObject.isValid()) {
 			Object* owner = owningObject->getOutermostOwner();
 			if(owner == nullptr){
@@ -1837,8 +500,12 @@ public:
 			owner->unregisterEventHandle(this);
 		}
 
-		owningObject = cast<Object>(object);
-		callback = BindHelper<Args...>::template get(object, function);
+		owningObject = object;
+		setPriority(priority);
+
+#ifdef CONFIG_CMF_EVENT_INSTRUMENTATION
+		stats.setLabel(object->getName());
+#endif
 
 		Object* owner = owningObject->getOutermostOwner();
 		if(owner == nullptr){
@@ -1851,95 +518,185 @@ public:
 	}
 
 	/**
-	 * @brief Bind function binds a std::function to the event as a callback paired with the owning object instance.
-	 * @tparam O The type of object the function is a member of.
-	 * @tparam F The type of function being bound.
-	 * @param object The instance of object owning the function.
-	 * @param function The function reference being bound.
-	 * @return Reference to this.
+	 * @brief Calls the callback inside the call, if the dispatch of the handle allows it for the calling task.
+	 * @param owner The outermost owner of the handle, kept alive by the caller.
+	 * @param args The arguments of the call.
+	 * @return True if the callback was called, false if the call has to be queued.
 	 */
-	template<typename O, typename F> requires (std::same_as<F, std::function<void(Args...)>> || std::same_as<F, std::function<void(Args...)>&> || std::same_as<F, const std::function<void(Args...)>&>)
-	inline EventHandle& bind(O* object, F&& function) noexcept {
-		if(owningObject.isValid()) {
-			Object* owner = owningObject->getOutermostOwner();
-			if(owner == nullptr){
-				owner = owningObject.get();
-			}
+	inline bool callDirectly(const Object* owner, const Args&... args) noexcept {
+		if(!callback && !batchCallback){
+			return false;
+		}
 
-			owner->unregisterEventHandle(this);
+		// Calls popped by a running scan are not in the queue anymore, but still have to be delivered first
+		if(scanInProgress.load(std::memory_order_acquire) || detached.load(std::memory_order_acquire)){
+			return false;
 		}
 
-		owningObject = object;
-		callback = function;
+		if(dispatch == EventDispatch::SameThread && !owner->isEventScanningTask()){
+			return false;
+		}
 
-		Object* owner = owningObject->getOutermostOwner();
-		if(owner == nullptr){
-			owner = owningObject.get();
+		// Calls queued before this one are delivered first, by the scan
+		if(!std::visit([](const auto& queue){ return queue.empty(); }, callQueue)){
+			return false;
 		}
 
-		owner->registerEventHandle(this);
+		stats.recordDirectCall();
+		const uint64_t start = stats.now();
 
-		return *this;
+		if(callback){
+			callback(args...);
+		}else{
+			const std::tuple<Args...> arguments(args...);
+			batchCallback(Batch(&arguments, 1));
+		}
+
+		stats.recordCallback(start);
+
+		return true;
 	}
 
 	/**
-	 * @brief Call function queues an argument std::tuple into the call queue for the callback functions to be called with in the next scan call.
-	 * @param args The arguments for the next event call.
-	 * @return True if successful, false otherwise.
+	 * @brief Queues a call into the locking or MPSC queue, following the overflow policy of the handle.
+	 * @param owner The outermost owner of the handle, kept alive by the caller.
+	 * @param arguments The arguments of the call.
+	 * @return True if the call was queued, false if it was discarded.
 	 */
-	inline bool call(const Args&... args) noexcept {
-		return callQueue.push(std::tuple<Args...>(args...));
+	inline bool enqueue(const Object* owner, std::tuple<Args...>&& arguments) noexcept {
+		const EventOverflowPolicy policy = overflow.policy;
+
+		if(MPSCCallQueue* queue = std::get_if<MPSCCallQueue>(&callQueue)){
+			// The limit is checked when reserving the slot, so concurrent callers can not push the queue past it
+			const size_t limit = overflow.limit > 0 ? overflow.limit : queue->capacity();
+			const auto tryPush = [queue, limit, &arguments]{ return queue->pushBounded(std::move(arguments), limit); };
+
+			return policy == EventOverflowPolicy::Block ? waitForRoom(owner, tryPush) : tryPush();
+		}
+
+		LockingCallQueue& queue = std::get<LockingCallQueue>(callQueue);
+		const size_t limit = overflow.limit > 0 ? overflow.limit : CONFIG_CMF_EVENT_DEFAULT_QUEUE_SIZE;
+
+		switch(policy){
+			case EventOverflowPolicy::Grow:
+				return overflow.limit > 0 ? queue.pushBounded(std::move(arguments), limit) : queue.push(std::move(arguments));
+			case EventOverflowPolicy::DropNewest:
+				return queue.pushBounded(std::move(arguments), limit);
+			case EventOverflowPolicy::DropOldest:
+				if(queue.pushReplacingOldest(std::move(arguments), limit)){
+					overflowDrops.fetch_add(1, std::memory_order_relaxed);
+					stats.recordDrop();
+				}
+
+				return true;
+			case EventOverflowPolicy::Block:
+				return waitForRoom(owner, [&queue, limit, &arguments]{ return queue.pushBounded(std::move(arguments), limit); });
+		}
+
+		return false;
 	}
 
 	/**
-	 * @brief Function probes for if an event call has been queued and is ready to trigger.
-	 * @param wait The maximum wait time for the probing to succeed.
-	 * @return True if there is a queued event call, false otherwise.
+	 * @brief Repeats a push until it succeeds or the overflow timeout passes. Pushes from the owner task are attempted only once.
+	 * @param owner The outermost owner of the handle, kept alive by the caller.
+	 * @param tryPush Function attempting the push, returning true if it succeeded. Has to leave the arguments untouched when failing.
+	 * @return True if the push succeeded.
 	 */
-	inline virtual bool probe(TickType_t wait) noexcept override {
-		std::tuple<Args...> arguments;
-		return callQueue.front(arguments, wait);
+	template<typename F>
+	inline bool waitForRoom(const Object* owner, F&& tryPush) noexcept {
+		if(tryPush()){
+			return true;
+		}
+
+		if(overflow.timeout == 0 || owner->isEventScanningTask()){
+			return false;
+		}
+
+		const TickType_t start = xTaskGetTickCount();
+		while(xTaskGetTickCount() - start < overflow.timeout){
+			vTaskDelay(1);
+
+			if(tryPush()){
+				return true;
+			}
+		}
+
+		return false;
 	}
 
 	/**
-	 * @brief Scan function triggers a callback for each triggered event call.
+	 * @brief Pops the queued calls a few at a time and passes each of them to the callback, repeating while calls keep arriving and time is left.
 	 * @param wait Maximum wait time for collective calling of all callbacks with all arguments.
-	 * When the time is up, callback triggering will abort even if more events remain.
 	 */
-	inline virtual void scan(TickType_t wait) noexcept override {
-		if(!owningObject.isValid()){
-			return;
-		}
+	inline void scanQueued(TickType_t wait) noexcept {
+		std::visit([this, wait](auto& queue) mutable {
+			std::tuple<Args...> batch[ScanBatchSize];
 
-		if(callback == nullptr){
-			return;
-		}
+			while(!queue.empty() && !detached.load(std::memory_order_acquire)){
+				const uint64_t beginTime = millis();
 
-		while(!callQueue.empty()){
-			const uint64_t beginTime = millis();
+				const size_t count = queue.popN(batch, wait);
+				if(count == 0){
+					break;
+				}
 
-			std::tuple<Args...> arguments;
-			if(!callQueue.pop(arguments, wait)){
-				break;
+				for(size_t i = 0; i < count && !detached.load(std::memory_order_acquire); ++i){
+					const uint64_t start = stats.now();
+					std::apply(callback, batch[i]);
+					stats.recordCallback(start);
+				}
+
+				wait = std::max((uint64_t)0, (uint64_t) (wait - (millis() - beginTime)));
 			}
+		}, callQueue);
+	}
 
-			CallHelper<Args...>::call(callback, arguments);
+	/**
+	 * @brief Pops all pending calls at once and passes them to the batched callback, repeating while calls keep arriving and time is left.
+	 * @param wait Maximum wait time for collective calling of the batched callback.
+	 */
+	inline void scanBatched(TickType_t wait) noexcept {
+		std::visit([this, wait](auto& queue) mutable {
+			while(!queue.empty() && !detached.load(std::memory_order_acquire)){
+				const uint64_t beginTime = millis();
 
-			wait = std::max((uint64_t)0, (uint64_t) (wait - (millis() - beginTime)));
-		}
+				batchBuffer.clear();
+
+				size_t count;
+				if constexpr(requires { queue.popAll(batchBuffer, wait); }){
+					count = queue.popAll(batchBuffer, wait);
+				}else{
+					batchBuffer.resize(queue.size());
+					count = queue.popN(batchBuffer, wait);
+				}
+
+				if(count == 0){
+					break;
+				}
+
+				const uint64_t start = stats.now();
+				batchCallback(Batch(batchBuffer.data(), count));
+				stats.recordCallback(start);
+
+				wait = std::max((uint64_t)0, (uint64_t) (wait - (millis() - beginTime)));
+			}
+		}, callQueue);
 	}
 
 	/**
-	* @brief  Unblock the queue multithreaded safety to unblock all threads waiting on it.
-	*/
-	inline virtual void unblock() noexcept override {
-		callQueue.setKillPill(true);
+	 * @param queueType The type of queue being created.
+	 * @return The call queue of the given type, constructed in place.
+	 */
+	inline static CallQueue makeCallQueue(EventQueueType queueType) noexcept {
+		switch(queueType){
+			case EventQueueType::MPSC:
+				return CallQueue(std::in_place_index<1>);
+			case EventQueueType::Latest:
+				return CallQueue(std::in_place_index<2>);
+			default:
+				return CallQueue(std::in_place_index<0>);
+		}
 	}
-
-private:
-	WeakObjectPtr<Object> owningObject = nullptr; // Object of which the callback is a member, in case this owning object
-	std::function<void(Args...)> callback = nullptr;
-	Queue<std::tuple<Args...>> callQueue;
 };
 
 #endif //CMF_EVENTHANDLE_H
\ No newline at end of file
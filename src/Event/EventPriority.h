@@ -0,0 +1,22 @@
+#ifndef CMF_EVENTPRIORITY_H
+#define CMF_EVENTPRIORITY_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief The priority with which the ready event handles of an object are scanned.
+ * Handles of higher priority are scanned first, lower priority handles are only delayed up to a limit, see CONFIG_CMF_EVENT_STARVATION_LIMIT.
+ */
+enum class EventPriority : uint8_t {
+	Low,
+	Normal,
+	High
+};
+
+/**
+ * @brief The number of event priority levels.
+ */
+static constexpr size_t EventPriorityCount = 3;
+
+#endif //CMF_EVENTPRIORITY_H
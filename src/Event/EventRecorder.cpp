@@ -0,0 +1,61 @@
+#include "EventRecorder.h"
+#include "Util/stdafx.h"
+
+EventRecorder::EventRecorder() noexcept{
+	archive.setEncoding(Archive::Encoding::Compact);
+}
+
+EventRecorder::~EventRecorder() noexcept{
+	stop();
+}
+
+void EventRecorder::start() noexcept{
+	std::lock_guard guard(activeMutex);
+
+	std::vector<uint8_t> discarded;
+	archive.takeByteArray(discarded);
+
+	entryCount = 0;
+	lastEntryTime = micros();
+	active = this;
+}
+
+void EventRecorder::stop() noexcept{
+	std::lock_guard guard(activeMutex);
+
+	if(active == this){
+		active = nullptr;
+	}
+}
+
+bool EventRecorder::isRecording() const noexcept{
+	std::lock_guard guard(activeMutex);
+	return active == this;
+}
+
+size_t EventRecorder::getEntryCount() const noexcept{
+	std::lock_guard guard(activeMutex);
+	return entryCount;
+}
+
+size_t EventRecorder::getLogSize() const noexcept{
+	std::lock_guard guard(activeMutex);
+	return archive.size();
+}
+
+void EventRecorder::takeLog(std::vector<uint8_t>& buffer) noexcept{
+	std::lock_guard guard(activeMutex);
+
+	archive.takeByteArray(buffer);
+	entryCount = 0;
+}
+
+void EventRecorder::beginEntry(uint32_t id) noexcept{
+	const uint64_t time = micros();
+
+	archive << (uint32_t) id;
+	archive << (uint64_t) (time - lastEntryTime);
+
+	lastEntryTime = time;
+	++entryCount;
+}
@@ -0,0 +1,184 @@
+#ifndef CMF_EVENTRECORDER_H
+#define CMF_EVENTRECORDER_H
+
+#include <sdkconfig.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+#include "Containers/Archive.h"
+#include "Misc/Enum.h"
+
+/**
+ * @brief Conversion of event arguments to and from the archive of an event log, shared by the EventRecorder and the EventReplayer.
+ * Supports every type archives support directly, as well as enums and class enums declared with DECLARE_CLASS_ENUM.
+ * Integers are stored by their width, so the log does not depend on which fixed width type the platform aliases them to.
+ */
+struct EventArgument {
+	/**
+	 * @brief Writes an argument into the archive.
+	 * @tparam T The type of argument.
+	 * @param archive The archive being written to.
+	 * @param value The argument being written.
+	 */
+	template<typename T>
+	static void write(InArchive& archive, const T& value) noexcept {
+		if constexpr(std::is_enum_v<T>){
+			write(archive, static_cast<std::underlying_type_t<T>>(value));
+		}else if constexpr(IsClassEnum<T>){
+			write(archive, static_cast<ClassEnumType<T>>(value));
+		}else if constexpr(std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, wchar_t>){
+			archive << static_cast<FixedWidth<T>>(value);
+		}else{
+			static_assert(requires { archive << value; }, "Event argument type can not be recorded, only types supported by Archive and enums are");
+			archive << value;
+		}
+	}
+
+	/**
+	 * @brief Reads an argument from the archive.
+	 * @tparam T The type of argument.
+	 * @param archive The archive being read from.
+	 * @param value The variable being set to the argument.
+	 */
+	template<typename T>
+	static void read(OutArchive& archive, T& value) noexcept {
+		if constexpr(std::is_enum_v<T>){
+			std::underlying_type_t<T> underlying{};
+			read(archive, underlying);
+			value = static_cast<T>(underlying);
+		}else if constexpr(IsClassEnum<T>){
+			ClassEnumType<T> underlying{};
+			read(archive, underlying);
+			value = T(underlying);
+		}else if constexpr(std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, wchar_t>){
+			FixedWidth<T> fixed = 0;
+			archive << fixed;
+			value = static_cast<T>(fixed);
+		}else{
+			archive << value;
+		}
+	}
+
+private:
+	template<typename U, typename V>
+	static U classEnumType(const Enum<U, V>*) noexcept;
+
+	template<typename T>
+	static constexpr bool IsClassEnum = requires { classEnumType((const T*) nullptr); };
+
+	template<typename T>
+	using ClassEnumType = decltype(classEnumType((const T*) nullptr));
+
+	template<typename T>
+	using UnsignedWidth = std::conditional_t<sizeof(T) == 1, uint8_t, std::conditional_t<sizeof(T) == 2, uint16_t, std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>>;
+
+	template<typename T>
+	using FixedWidth = std::conditional_t<std::is_signed_v<T>, std::make_signed_t<UnsignedWidth<T>>, UnsignedWidth<T>>;
+};
+
+/**
+ * @brief Records the broadcasts of events into a compact binary log, which the EventReplayer can inject into an application again.
+ * Only events given a record ID with Event::setRecordID() are recorded, each broadcast as one entry of its record ID,
+ * the time in microseconds since the previous entry, and its arguments.
+ * The log uses the compact archive encoding, so small record IDs, short intervals and small arguments take a byte each.
+ * A single recorder is active at a time, broadcasts from all threads are recorded into it in the order they happen.
+ * Recording is compiled in only when CONFIG_CMF_EVENT_RECORDING is enabled.
+ */
+class EventRecorder {
+public:
+	/**
+	 * @brief Default constructor of an inactive recorder with an empty log.
+	 */
+	EventRecorder() noexcept;
+
+	/**
+	 * @brief Destructor, stops the recording.
+	 */
+	~EventRecorder() noexcept;
+
+	/**
+	 * @brief Deleted copy constructor, since the active recorder is referred to while recording.
+	 */
+	EventRecorder(const EventRecorder&) = delete;
+
+	/**
+	 * @brief Deleted copy assignment.
+	 */
+	EventRecorder& operator = (const EventRecorder&) = delete;
+
+	/**
+	 * @brief Clears the log and starts recording into it. Stops the recording of any other recorder.
+	 */
+	void start() noexcept;
+
+	/**
+	 * @brief Stops recording, the log recorded so far is kept.
+	 */
+	void stop() noexcept;
+
+	/**
+	 * @return True if this recorder is the active one, false otherwise.
+	 */
+	bool isRecording() const noexcept;
+
+	/**
+	 * @return The number of broadcasts in the log.
+	 */
+	size_t getEntryCount() const noexcept;
+
+	/**
+	 * @return The size of the log in bytes.
+	 */
+	size_t getLogSize() const noexcept;
+
+	/**
+	 * @brief Moves the log recorded so far into the given byte array, leaving the log of the recorder empty.
+	 * Recording continues into the emptied log if active, with the time of the next entry still relative to the previous one.
+	 * @param buffer The byte vector the log is moved into.
+	 */
+	void takeLog(std::vector<uint8_t>& buffer) noexcept;
+
+	/**
+	 * @brief Records a broadcast into the active recorder, if there is one. Called by events with a record ID when they are broadcast.
+	 * @param id The record ID of the event.
+	 * @param args The arguments of the broadcast.
+	 */
+	template<typename ...Args>
+	static void record(uint32_t id, const Args&... args) noexcept {
+		// Broadcasts of events with a record ID only take the lock while something is being recorded
+		if(active.load(std::memory_order_relaxed) == nullptr){
+			return;
+		}
+
+		std::lock_guard guard(activeMutex);
+
+		EventRecorder* recorder = active.load(std::memory_order_relaxed);
+		if(recorder == nullptr){
+			return;
+		}
+
+		recorder->beginEntry(id);
+		(EventArgument::write(recorder->archive, args), ...);
+	}
+
+private:
+	InArchive archive;
+	uint64_t lastEntryTime = 0;
+	size_t entryCount = 0;
+
+	// Guards the log of the active recorder as well, so recording can not race with the recorder being stopped or destroyed
+	inline static std::mutex activeMutex;
+	inline static std::atomic<EventRecorder*> active = nullptr;
+
+private:
+	/**
+	 * @brief Writes the header of an entry, has to be called with the active mutex locked.
+	 * @param id The record ID of the event.
+	 */
+	void beginEntry(uint32_t id) noexcept;
+};
+
+#endif //CMF_EVENTRECORDER_H
@@ -0,0 +1,82 @@
+#include "EventReplayer.h"
+#include <cinttypes>
+#include "Log/Log.h"
+#include "Util/stdafx.h"
+
+EventReplayer::EventReplayer(std::vector<uint8_t>&& log) noexcept : log(std::move(log)){
+	rewind();
+}
+
+bool EventReplayer::step() noexcept{
+	if(!peek()){
+		return false;
+	}
+
+	const auto it = injectors.find(pendingID);
+	if(it == injectors.end()){
+		// The arguments of an unknown event can not be skipped, since their size is not known
+		CMF_LOG(CMF, Warning, "Replay stopped at an entry of record ID %" PRIu32 ", which has no event added", pendingID);
+		finished = true;
+		return false;
+	}
+
+	pending = false;
+	it->second.inject(it->second.event, archive);
+
+	return true;
+}
+
+size_t EventReplayer::play(float speed) noexcept{
+	size_t count = 0;
+	uint64_t target = micros();
+
+	while(peek()){
+		if(speed > 0){
+			target += (uint64_t) (pendingDelay / speed);
+
+			const uint64_t now = micros();
+			if(target > now){
+				const uint64_t wait = target - now;
+				delayMillis(wait / 1000);
+				delayMicros(wait % 1000);
+			}
+		}
+
+		if(!step()){
+			break;
+		}
+
+		++count;
+	}
+
+	return count;
+}
+
+void EventReplayer::rewind() noexcept{
+	archive = OutArchive::view(log);
+	archive.setEncoding(Archive::Encoding::Compact);
+
+	finished = false;
+	pending = false;
+}
+
+bool EventReplayer::isFinished() const noexcept{
+	return finished;
+}
+
+bool EventReplayer::peek() noexcept{
+	if(pending){
+		return true;
+	}
+
+	if(finished || archive.size() == 0){
+		finished = true;
+		return false;
+	}
+
+	archive << pendingID;
+	archive << pendingDelay;
+	pending = true;
+
+	return true;
+}
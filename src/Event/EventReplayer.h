@@ -0,0 +1,108 @@
+#ifndef CMF_EVENTREPLAYER_H
+#define CMF_EVENTREPLAYER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+#include "Event.h"
+#include "EventRecorder.h"
+#include "Containers/Archive.h"
+
+/**
+ * @brief Injects the broadcasts of a log recorded by the EventRecorder into the events of an application again,
+ * at the recorded pace, at a multiple of it, or as fast as possible. Used for repeatable benchmarks and regression runs.
+ * Each record ID in the log has to be mapped to the event it is broadcast on with add(), before the log is replayed.
+ * Replayed broadcasts bypass the owner check of EventBroadcaster, and reach the bound callbacks the same way the recorded ones did.
+ */
+class EventReplayer {
+public:
+	/**
+	 * @brief Constructor which takes over the given log without copying it.
+	 * @param log Byte vector containing the log. Vector is empty after constructor finishes execution.
+	 */
+	explicit EventReplayer(std::vector<uint8_t>&& log) noexcept;
+
+	/**
+	 * @brief Deleted copy constructor, since the archive reads from the log held by the replayer.
+	 */
+	EventReplayer(const EventReplayer&) = delete;
+
+	/**
+	 * @brief Deleted copy assignment.
+	 */
+	EventReplayer& operator = (const EventReplayer&) = delete;
+
+	/**
+	 * @brief Maps a record ID to the event its entries are broadcast on. The event has to outlive the replay.
+	 * @tparam Args The arguments of the event, which have to match the ones the entries were recorded with.
+	 * @param id The record ID the event was recorded with.
+	 * @param event The event being broadcast.
+	 */
+	template<typename ...Args>
+	void add(uint32_t id, Event<Args...>& event) noexcept {
+		injectors[id] = Injector{ &event, [](void* event, OutArchive& archive){
+			std::tuple<std::remove_cvref_t<Args>...> args;
+
+			std::apply([&archive](auto&... arg){
+				(EventArgument::read(archive, arg), ...);
+			}, args);
+
+			std::apply([event](const auto&... arg){
+				static_cast<Event<Args...>*>(event)->_broadcast(arg...);
+			}, args);
+		}};
+	}
+
+	/**
+	 * @brief Broadcasts the next entry of the log right away.
+	 * @return True if an entry was broadcast, false if the log ended or the entry is of a record ID which was not added.
+	 */
+	bool step() noexcept;
+
+	/**
+	 * @brief Broadcasts the remaining entries of the log, blocking until the log ends.
+	 * @param speed Multiple of the recorded pace the entries are broadcast at. 0 broadcasts them as fast as possible, without waiting between them.
+	 * @return The number of entries broadcast.
+	 */
+	size_t play(float speed = 1.0f) noexcept;
+
+	/**
+	 * @brief Restarts the replay from the first entry of the log.
+	 */
+	void rewind() noexcept;
+
+	/**
+	 * @return True if all entries of the log were broadcast, or the replay stopped at an entry of a record ID which was not added.
+	 */
+	bool isFinished() const noexcept;
+
+private:
+	/**
+	 * @brief Reads the arguments of an entry and broadcasts them on the event.
+	 */
+	struct Injector {
+		void* event = nullptr;
+		void (*inject)(void* event, OutArchive& archive) = nullptr;
+	};
+
+	std::vector<uint8_t> log;
+	OutArchive archive;
+	std::unordered_map<uint32_t, Injector> injectors;
+	bool finished = false;
+
+	uint32_t pendingID = 0;
+	uint64_t pendingDelay = 0;
+	bool pending = false;
+
+private:
+	/**
+	 * @brief Reads the header of the next entry, unless it was already read.
+	 * @return True if there is a next entry, false otherwise.
+	 */
+	bool peek() noexcept;
+};
+
+#endif //CMF_EVENTREPLAYER_H
@@ -0,0 +1,123 @@
+#include "EventStats.h"
+
+#ifdef CONFIG_CMF_EVENT_INSTRUMENTATION
+
+#include <algorithm>
+#include <cinttypes>
+#include "Log/Log.h"
+
+EventStats::EventStats() noexcept{
+	std::lock_guard guard(registryMutex);
+
+	next = registryHead;
+	if(next != nullptr){
+		next->previous = this;
+	}
+
+	registryHead = this;
+}
+
+EventStats::~EventStats() noexcept{
+	std::lock_guard guard(registryMutex);
+
+	if(previous != nullptr){
+		previous->next = next;
+	}else{
+		registryHead = next;
+	}
+
+	if(next != nullptr){
+		next->previous = previous;
+	}
+}
+
+void EventStats::setLabel(const std::string& value) noexcept{
+	std::lock_guard guard(labelMutex);
+	label = value;
+}
+
+std::string EventStats::getLabel() const noexcept{
+	std::lock_guard guard(labelMutex);
+	return label;
+}
+
+EventStats::Histogram EventStats::getLatencyHistogram() const noexcept{
+	Histogram histogram;
+	for(size_t i = 0; i < BucketCount; ++i){
+		histogram[i] = latency[i].load(std::memory_order_relaxed);
+	}
+
+	return histogram;
+}
+
+EventStats::Histogram EventStats::getCallbackTimeHistogram() const noexcept{
+	Histogram histogram;
+	for(size_t i = 0; i < BucketCount; ++i){
+		histogram[i] = callbackTime[i].load(std::memory_order_relaxed);
+	}
+
+	return histogram;
+}
+
+uint64_t EventStats::percentile(const Histogram& histogram, float fraction) noexcept{
+	uint64_t total = 0;
+	for(const uint32_t count : histogram){
+		total += count;
+	}
+
+	if(total == 0){
+		return 0;
+	}
+
+	const uint64_t target = std::max<uint64_t>(1, (uint64_t) (total * fraction + 0.5f));
+
+	uint64_t counted = 0;
+	for(size_t i = 0; i < BucketCount; ++i){
+		counted += histogram[i];
+		if(counted >= target){
+			return 1ull << i;
+		}
+	}
+
+	return 1ull << (BucketCount - 1);
+}
+
+void EventStats::reset() noexcept{
+	calls.store(0, std::memory_order_relaxed);
+	directCalls.store(0, std::memory_order_relaxed);
+	pushFailures.store(0, std::memory_order_relaxed);
+	drops.store(0, std::memory_order_relaxed);
+	callbacks.store(0, std::memory_order_relaxed);
+	peakDepth.store(0, std::memory_order_relaxed);
+	callbackTimeTotal.store(0, std::memory_order_relaxed);
+	callbackTimeMax.store(0, std::memory_order_relaxed);
+
+	for(size_t i = 0; i < BucketCount; ++i){
+		latency[i].store(0, std::memory_order_relaxed);
+		callbackTime[i].store(0, std::memory_order_relaxed);
+	}
+}
+
+void EventStats::log() const noexcept{
+	const Histogram latencies = getLatencyHistogram();
+	const Histogram callbackTimes = getCallbackTimeHistogram();
+	const uint32_t callbackCount = getCallbacks();
+	const uint64_t callbackAverage = callbackCount > 0 ? getCallbackTimeTotal() / callbackCount : 0;
+
+	CMF_LOG(CMF, Info, "Event handle '%s': %" PRIu32 " calls (%" PRIu32 " direct), last at %" PRIu64 " us, peak queue depth %zu, %" PRIu32 " push failures, %" PRIu32 " dropped, "
+			"latency p50 < %" PRIu64 " us p99 < %" PRIu64 " us, %" PRIu32 " callbacks avg %" PRIu64 " us p99 < %" PRIu64 " us max %" PRIu64 " us",
+			getLabel().c_str(), getCalls(), getDirectCalls(), getLastCallTime(), getPeakQueueDepth(), getPushFailures(), getDrops(),
+			percentile(latencies, 0.5f), percentile(latencies, 0.99f), callbackCount, callbackAverage, percentile(callbackTimes, 0.99f), getCallbackTimeMax());
+}
+
+void EventStats::logAll() noexcept{
+	forEach([](const EventStats& stats){
+		if(stats.getCalls() == 0){
+			return;
+		}
+
+		stats.log();
+	});
+}
+
+#endif
@@ -0,0 +1,278 @@
+#ifndef CMF_EVENTSTATS_H
+#define CMF_EVENTSTATS_H
+
+#include <sdkconfig.h>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include "Util/stdafx.h"
+
+#ifdef CONFIG_CMF_EVENT_INSTRUMENTATION
+
+/**
+ * @brief Delivery statistics of a single event handle, used to size event queues and find slow callbacks.
+ * Counts calls, failed pushes, calls replaced in Latest queues and direct dispatches, tracks the peak queue depth and the time of the last call,
+ * and keeps histograms of the queueing latency and of the callback execution time.
+ * Queueing latency is measured for the oldest pending call of each burst, from its call to the start of the scan delivering it.
+ * All instances are kept in a registry, which can be iterated and logged, periodically by the EventStatsReporter.
+ * When CONFIG_CMF_EVENT_INSTRUMENTATION is disabled, this class is replaced by an empty one with the same interface, and recording compiles away.
+ */
+class EventStats {
+public:
+	/**
+	 * @brief Number of histogram buckets. Bucket i counts durations below 2^i microseconds, the last one counts all longer durations.
+	 */
+	static constexpr size_t BucketCount = 20;
+
+	using Histogram = std::array<uint32_t, BucketCount>;
+
+	/**
+	 * @brief Constructor, adds the statistics to the registry.
+	 */
+	EventStats() noexcept;
+
+	/**
+	 * @brief Destructor, removes the statistics from the registry.
+	 */
+	~EventStats() noexcept;
+
+	/**
+	 * @brief Deleted copy constructor, since the registry refers to each instance.
+	 */
+	EventStats(const EventStats&) = delete;
+
+	/**
+	 * @brief Deleted copy assignment.
+	 */
+	EventStats& operator = (const EventStats&) = delete;
+
+	/**
+	 * @return Timestamp in microseconds used to measure the duration of a callback.
+	 */
+	inline uint64_t now() const noexcept {
+		return micros();
+	}
+
+	/**
+	 * @brief Records a call queued into the handle.
+	 * @param depth Function returning the queue depth after the call was queued.
+	 */
+	template<typename F>
+	inline void recordCall(F&& depth) noexcept {
+		const uint64_t time = micros();
+		calls.fetch_add(1, std::memory_order_relaxed);
+		lastCallTime.store(time, std::memory_order_relaxed);
+
+		const size_t currentDepth = depth();
+		size_t peak = peakDepth.load(std::memory_order_relaxed);
+		while(currentDepth > peak && !peakDepth.compare_exchange_weak(peak, currentDepth, std::memory_order_relaxed)){}
+
+		// The call which finds the queue empty is the oldest of its burst
+		if(currentDepth == 1){
+			uint64_t expected = 0;
+			pendingSince.compare_exchange_strong(expected, time, std::memory_order_relaxed);
+		}
+	}
+
+	/**
+	 * @brief Records a call whose callback was called directly instead of queueing it.
+	 */
+	inline void recordDirectCall() noexcept {
+		calls.fetch_add(1, std::memory_order_relaxed);
+		directCalls.fetch_add(1, std::memory_order_relaxed);
+		lastCallTime.store(micros(), std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief Records a call which could not be queued.
+	 */
+	inline void recordPushFailure() noexcept {
+		pushFailures.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief Records a pending call replaced by a newer one.
+	 */
+	inline void recordDrop() noexcept {
+		drops.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief Records the queueing latency of the oldest pending call, called when a scan starts delivering the pending calls.
+	 */
+	inline void recordDispatch() noexcept {
+		const uint64_t since = pendingSince.exchange(0, std::memory_order_relaxed);
+		if(since != 0){
+			record(latency, micros() - since);
+		}
+	}
+
+	/**
+	 * @brief Records the execution time of a callback.
+	 * @param start Timestamp taken with now() before the callback was called.
+	 */
+	inline void recordCallback(uint64_t start) noexcept {
+		const uint64_t duration = micros() - start;
+		callbacks.fetch_add(1, std::memory_order_relaxed);
+		callbackTimeTotal.fetch_add(duration, std::memory_order_relaxed);
+
+		uint64_t peak = callbackTimeMax.load(std::memory_order_relaxed);
+		while(duration > peak && !callbackTimeMax.compare_exchange_weak(peak, duration, std::memory_order_relaxed)){}
+
+		record(callbackTime, duration);
+	}
+
+	/**
+	 * @param value The label the statistics are logged with, usually the name of the object owning the handle.
+	 */
+	void setLabel(const std::string& value) noexcept;
+
+	/**
+	 * @return The label the statistics are logged with.
+	 */
+	std::string getLabel() const noexcept;
+
+	inline uint32_t getCalls() const noexcept { return calls.load(std::memory_order_relaxed); }
+	inline uint32_t getDirectCalls() const noexcept { return directCalls.load(std::memory_order_relaxed); }
+	inline uint32_t getPushFailures() const noexcept { return pushFailures.load(std::memory_order_relaxed); }
+	inline uint32_t getDrops() const noexcept { return drops.load(std::memory_order_relaxed); }
+	inline uint32_t getCallbacks() const noexcept { return callbacks.load(std::memory_order_relaxed); }
+	inline size_t getPeakQueueDepth() const noexcept { return peakDepth.load(std::memory_order_relaxed); }
+	inline uint64_t getLastCallTime() const noexcept { return lastCallTime.load(std::memory_order_relaxed); }
+	inline uint64_t getCallbackTimeTotal() const noexcept { return callbackTimeTotal.load(std::memory_order_relaxed); }
+	inline uint64_t getCallbackTimeMax() const noexcept { return callbackTimeMax.load(std::memory_order_relaxed); }
+
+	/**
+	 * @return Histogram of queueing latencies in microseconds.
+	 */
+	Histogram getLatencyHistogram() const noexcept;
+
+	/**
+	 * @return Histogram of callback execution times in microseconds.
+	 */
+	Histogram getCallbackTimeHistogram() const noexcept;
+
+	/**
+	 * @param histogram The histogram being evaluated.
+	 * @param fraction The fraction of samples, from 0 to 1.
+	 * @return The upper bound in microseconds of the bucket containing the given fraction of the samples, 0 if there are none.
+	 */
+	static uint64_t percentile(const Histogram& histogram, float fraction) noexcept;
+
+	/**
+	 * @brief Clears all counters and histograms.
+	 */
+	void reset() noexcept;
+
+	/**
+	 * @brief Logs the statistics in a single line.
+	 */
+	void log() const noexcept;
+
+	/**
+	 * @brief Calls the given function for each registered instance. Instances can not be destroyed while this runs.
+	 * @param function The function, called with a reference to the statistics.
+	 */
+	template<typename F>
+	static void forEach(F&& function) noexcept {
+		std::lock_guard guard(registryMutex);
+
+		for(const EventStats* stats = registryHead; stats != nullptr; stats = stats->next){
+			function(*stats);
+		}
+	}
+
+	/**
+	 * @brief Logs the statistics of all handles which received calls.
+	 */
+	static void logAll() noexcept;
+
+private:
+	std::atomic_uint32_t calls = 0;
+	std::atomic_uint32_t directCalls = 0;
+	std::atomic_uint32_t pushFailures = 0;
+	std::atomic_uint32_t drops = 0;
+	std::atomic_uint32_t callbacks = 0;
+	std::atomic_size_t peakDepth = 0;
+	std::atomic_uint64_t lastCallTime = 0;
+	std::atomic_uint64_t pendingSince = 0;
+	std::atomic_uint64_t callbackTimeTotal = 0;
+	std::atomic_uint64_t callbackTimeMax = 0;
+	std::array<std::atomic_uint32_t, BucketCount> latency = {};
+	std::array<std::atomic_uint32_t, BucketCount> callbackTime = {};
+
+	mutable std::mutex labelMutex;
+	std::string label;
+
+	EventStats* previous = nullptr;
+	EventStats* next = nullptr;
+
+	inline static std::mutex registryMutex;
+	inline static EventStats* registryHead = nullptr;
+
+private:
+	inline static void record(std::array<std::atomic_uint32_t, BucketCount>& histogram, uint64_t duration) noexcept {
+		size_t bucket = 0;
+		while(bucket < BucketCount - 1 && duration >= (1ull << bucket)){
+			++bucket;
+		}
+
+		histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+	}
+};
+
+#else
+
+/**
+ * @brief Empty stand-in for the event handle statistics while CONFIG_CMF_EVENT_INSTRUMENTATION is disabled.
+ * All recording is a no-op which compiles away, and all values read as zero.
+ */
+class EventStats {
+public:
+	static constexpr size_t BucketCount = 20;
+
+	using Histogram = std::array<uint32_t, BucketCount>;
+
+	inline constexpr uint64_t now() const noexcept { return 0; }
+
+	template<typename F>
+	inline constexpr void recordCall(F&&) noexcept {}
+
+	inline constexpr void recordDirectCall() noexcept {}
+	inline constexpr void recordPushFailure() noexcept {}
+	inline constexpr void recordDrop() noexcept {}
+	inline constexpr void recordDispatch() noexcept {}
+	inline constexpr void recordCallback(uint64_t) noexcept {}
+
+	inline void setLabel(const std::string&) noexcept {}
+	inline std::string getLabel() const noexcept { return {}; }
+
+	inline constexpr uint32_t getCalls() const noexcept { return 0; }
+	inline constexpr uint32_t getDirectCalls() const noexcept { return 0; }
+	inline constexpr uint32_t getPushFailures() const noexcept { return 0; }
+	inline constexpr uint32_t getDrops() const noexcept { return 0; }
+	inline constexpr uint32_t getCallbacks() const noexcept { return 0; }
+	inline constexpr size_t getPeakQueueDepth() const noexcept { return 0; }
+	inline constexpr uint64_t getLastCallTime() const noexcept { return 0; }
+	inline constexpr uint64_t getCallbackTimeTotal() const noexcept { return 0; }
+	inline constexpr uint64_t getCallbackTimeMax() const noexcept { return 0; }
+	inline constexpr Histogram getLatencyHistogram() const noexcept { return {}; }
+	inline constexpr Histogram getCallbackTimeHistogram() const noexcept { return {}; }
+
+	inline static constexpr uint64_t percentile(const Histogram&, float) noexcept { return 0; }
+
+	inline constexpr void reset() noexcept {}
+	inline constexpr void log() const noexcept {}
+
+	template<typename F>
+	inline static constexpr void forEach(F&&) noexcept {}
+
+	inline static constexpr void logAll() noexcept {}
+};
+
+#endif
+
+#endif //CMF_EVENTSTATS_H
@@ -0,0 +1,15 @@
+#include "EventStatsReporter.h"
+#include "EventStats.h"
+#include "Util/stdafx.h"
+
+EventStatsReporter::EventStatsReporter() noexcept : lastDump(millis()) {}
+
+void EventStatsReporter::tick([[maybe_unused]] float deltaTime) noexcept{
+	if(Interval == 0 || millis() - lastDump < Interval){
+		return;
+	}
+
+	lastDump = millis();
+
+	EventStats::logAll();
+}
@@ -0,0 +1,42 @@
+#ifndef CMF_EVENTSTATSREPORTER_H
+#define CMF_EVENTSTATSREPORTER_H
+
+#include "Entity/SyncEntity.h"
+#include "Object/Class.h"
+
+/**
+ * @brief Periodically logs the delivery statistics of all event handles which received calls, see EventStats.
+ * Created by the framework at startup when CONFIG_CMF_EVENT_INSTRUMENTATION is enabled and the dump interval is not 0.
+ */
+class EventStatsReporter : public SyncEntity {
+	GENERATED_BODY(EventStatsReporter, SyncEntity, void)
+
+public:
+	/**
+	 * @brief Default constructor, starts the first interval.
+	 */
+	EventStatsReporter() noexcept;
+
+	/**
+	 * @brief Default destructor.
+	 */
+	virtual ~EventStatsReporter() noexcept override = default;
+
+protected:
+	/**
+	 * @brief Logs the statistics once the interval has passed since the last dump.
+	 * @param deltaTime How much time has passed since the last tick call.
+	 */
+	virtual void tick(float deltaTime) noexcept override;
+
+private:
+	uint64_t lastDump;
+
+#ifdef CONFIG_CMF_EVENT_INSTRUMENTATION
+	inline static constexpr uint64_t Interval = CONFIG_CMF_EVENT_INSTRUMENTATION_DUMP_INTERVAL;
+#else
+	inline static constexpr uint64_t Interval = 0;
+#endif
+};
+
+#endif //CMF_EVENTSTATSREPORTER_H
@@ -0,0 +1,381 @@
+#include "EventTimer.h"
+#include <algorithm>
+#include <bit>
+#include <utility>
+#include "Util/stdafx.h"
+
+// Level of entries taken out of the wheel while their slot is being expired
+static constexpr uint8_t ExpiringLevel = UINT8_MAX;
+
+static constexpr uint64_t toTicks(uint32_t millis) noexcept{
+	return ((uint64_t) millis + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS;
+}
+
+EventTimer::EventTimer(bool internalStack) : Super(0, CONFIG_CMF_EVENTTIMER_STACK_SIZE, CONFIG_CMF_EVENTTIMER_THREAD_PRIORITY, CONFIG_CMF_EVENTTIMER_CPU_CORE, internalStack), nextTick(currentTick()) {
+	wakeSemaphore = xSemaphoreCreateBinary();
+}
+
+EventTimer::~EventTimer(){
+	EventTimerEntry* released = nullptr;
+
+	{
+		std::lock_guard guard(wheelMutex);
+
+		// Events outliving the timer are left with empty lists
+		for(const auto& [id, entry] : entries){
+			unlinkFromEvent(entry);
+			entry->list->count.fetch_sub(1, std::memory_order_relaxed);
+			entry->next = released;
+			released = entry;
+		}
+
+		entries.clear();
+	}
+
+	deleteEntries(released);
+
+	vSemaphoreDelete(wakeSemaphore);
+}
+
+EventTimerID EventTimer::schedule(EventTimerEntry* entry, uint32_t delay, uint32_t period) noexcept{
+	if(entry == nullptr){
+		return 0;
+	}
+
+	std::lock_guard guard(wheelMutex);
+
+	const uint64_t now = currentTick();
+
+	// An empty wheel has nothing to process, so the ticks it slept through are skipped
+	if(entries.empty()){
+		nextTick = std::max(nextTick, now);
+	}
+
+	do{
+		entry->id = nextID++;
+	}while(entry->id == 0 || entries.contains(entry->id));
+
+	entry->expiry = now + toTicks(delay);
+	entry->period = period > 0 ? (uint32_t) std::max<uint64_t>(toTicks(period), 1) : 0;
+
+	entries[entry->id] = entry;
+	linkToEvent(entry);
+	entry->list->count.fetch_add(1, std::memory_order_relaxed);
+
+	insert(entry);
+
+	if(entry->expiry < plannedWakeUp){
+		plannedWakeUp = entry->expiry;
+		xSemaphoreGive(wakeSemaphore);
+	}
+
+	return entry->id;
+}
+
+bool EventTimer::cancel(EventTimerID id) noexcept{
+	EventTimerEntry* released = nullptr;
+
+	{
+		std::unique_lock lock(wheelMutex);
+
+		const auto it = entries.find(id);
+		if(it == entries.end()){
+			return false;
+		}
+
+		EventTimerEntry* entry = it->second;
+		entries.erase(it);
+		release(entry, released);
+		waitForFiring(entry, lock);
+	}
+
+	deleteEntries(released);
+
+	return true;
+}
+
+void EventTimer::cancelAll(EventTimerList& list) noexcept{
+	EventTimerEntry* released = nullptr;
+
+	{
+		std::unique_lock lock(wheelMutex);
+
+		while(EventTimerEntry* entry = list.first){
+			entries.erase(entry->id);
+			release(entry, released);
+		}
+
+		// The event may be destroyed by the running broadcast itself, so the timer stops counting it on the list right away
+		if(firingList == &list){
+			firingList = nullptr;
+			list.count.fetch_sub(1, std::memory_order_relaxed);
+			waitForFiring(firingEntry, lock);
+		}
+	}
+
+	deleteEntries(released);
+}
+
+size_t EventTimer::getScheduledCount() const noexcept{
+	std::lock_guard guard(wheelMutex);
+	return entries.size();
+}
+
+void EventTimer::tick(float deltaTime) noexcept{
+	Super::tick(deltaTime);
+
+	TickType_t wait = portMAX_DELAY;
+
+	{
+		std::lock_guard guard(wheelMutex);
+
+		plannedWakeUp = nextWakeUp();
+		if(plannedWakeUp != NoWakeUp){
+			const uint64_t now = currentTick();
+			wait = plannedWakeUp > now ? (TickType_t) std::min<uint64_t>(plannedWakeUp - now, portMAX_DELAY - 1) : 0;
+		}
+	}
+
+	// Given when a broadcast is scheduled before the planned wake up
+	xSemaphoreTake(wakeSemaphore, wait);
+
+	EventTimerEntry* finished = nullptr;
+
+	{
+		std::unique_lock lock(wheelMutex);
+
+		advance(currentTick(), lock);
+		finished = std::exchange(finishedEntries, nullptr);
+	}
+
+	deleteEntries(finished);
+}
+
+uint64_t EventTimer::currentTick() noexcept{
+	return millis() / portTICK_PERIOD_MS;
+}
+
+void EventTimer::insert(EventTimerEntry* entry) noexcept{
+	entry->expiry = std::max(entry->expiry, nextTick);
+
+	const uint64_t placement = std::min(entry->expiry, nextTick + WheelRange - 1);
+	const uint64_t distance = placement - nextTick;
+
+	size_t level = 0;
+	while(level < LevelCount - 1 && distance >= (1ull << (LevelBits * (level + 1)))){
+		++level;
+	}
+
+	const size_t slot = (placement >> (LevelBits * level)) & SlotMask;
+
+	entry->level = level;
+	entry->slot = slot;
+	entry->previous = nullptr;
+	entry->next = wheel[level][slot];
+
+	if(entry->next != nullptr){
+		entry->next->previous = entry;
+	}
+
+	wheel[level][slot] = entry;
+	occupiedSlots[level] |= 1ull << slot;
+}
+
+void EventTimer::remove(EventTimerEntry* entry) noexcept{
+	if(entry->previous != nullptr){
+		entry->previous->next = entry->next;
+	}else if(entry->level == ExpiringLevel){
+		expiringEntries = entry->next;
+	}else{
+		wheel[entry->level][entry->slot] = entry->next;
+
+		if(entry->next == nullptr){
+			occupiedSlots[entry->level] &= ~(1ull << entry->slot);
+		}
+	}
+
+	if(entry->next != nullptr){
+		entry->next->previous = entry->previous;
+	}
+
+	entry->previous = nullptr;
+	entry->next = nullptr;
+}
+
+void EventTimer::linkToEvent(EventTimerEntry* entry) noexcept{
+	EventTimerList& list = *entry->list;
+
+	entry->previousOfEvent = nullptr;
+	entry->nextOfEvent = list.first;
+
+	if(list.first != nullptr){
+		list.first->previousOfEvent = entry;
+	}
+
+	list.first = entry;
+}
+
+void EventTimer::unlinkFromEvent(EventTimerEntry* entry) noexcept{
+	if(entry->previousOfEvent != nullptr){
+		entry->previousOfEvent->nextOfEvent = entry->nextOfEvent;
+	}else{
+		entry->list->first = entry->nextOfEvent;
+	}
+
+	if(entry->nextOfEvent != nullptr){
+		entry->nextOfEvent->previousOfEvent = entry->previousOfEvent;
+	}
+
+	entry->previousOfEvent = nullptr;
+	entry->nextOfEvent = nullptr;
+}
+
+void EventTimer::release(EventTimerEntry* entry, EventTimerEntry*& released) noexcept{
+	unlinkFromEvent(entry);
+
+	// The running entry is out of the wheel, and stays counted through the firing list until its broadcast returns, so a destroyed event still waits for it
+	if(entry == firingEntry){
+		entry->list = nullptr;
+		return;
+	}
+
+	entry->list->count.fetch_sub(1, std::memory_order_relaxed);
+	remove(entry);
+
+	entry->next = released;
+	released = entry;
+}
+
+void EventTimer::waitForFiring(const EventTimerEntry* entry, std::unique_lock<std::mutex>& lock) noexcept{
+	// A broadcast cancelling its own entry runs on the timer thread, and would wait for itself
+	if(entry != firingEntry || firingTask == xTaskGetCurrentTaskHandle()){
+		return;
+	}
+
+	const uint32_t fired = firedCount;
+	firedCondition.wait(lock, [this, fired]{ return firedCount != fired; });
+}
+
+void EventTimer::deleteEntries(EventTimerEntry* list) noexcept{
+	while(list != nullptr){
+		EventTimerEntry* next = list->next;
+		delete list;
+		list = next;
+	}
+}
+
+void EventTimer::advance(uint64_t tick, std::unique_lock<std::mutex>& lock) noexcept{
+	while(nextTick <= tick){
+		// Ticks without occupied slots to expire or cascade are skipped
+		const uint64_t wakeUp = nextWakeUp();
+		if(wakeUp > tick){
+			nextTick = tick + 1;
+			return;
+		}
+
+		nextTick = std::max(nextTick, wakeUp);
+
+		const uint64_t current = nextTick;
+
+		if((current & SlotMask) == 0){
+			for(size_t level = 1; level < LevelCount; ++level){
+				const size_t slot = (current >> (LevelBits * level)) & SlotMask;
+				cascade(level, slot);
+
+				if(slot != 0){
+					break;
+				}
+			}
+		}
+
+		// Entries scheduled by the broadcasts are placed relative to the following tick, never into the slot being expired
+		nextTick = current + 1;
+		expire(current & SlotMask, lock);
+	}
+}
+
+void EventTimer::cascade(size_t level, size_t slot) noexcept{
+	EventTimerEntry* entry = wheel[level][slot];
+
+	wheel[level][slot] = nullptr;
+	occupiedSlots[level] &= ~(1ull << slot);
+
+	while(entry != nullptr){
+		EventTimerEntry* next = entry->next;
+		insert(entry);
+		entry = next;
+	}
+}
+
+void EventTimer::expire(size_t slot, std::unique_lock<std::mutex>& lock) noexcept{
+	expiringEntries = wheel[0][slot];
+
+	wheel[0][slot] = nullptr;
+	occupiedSlots[0] &= ~(1ull << slot);
+
+	for(EventTimerEntry* entry = expiringEntries; entry != nullptr; entry = entry->next){
+		entry->level = ExpiringLevel;
+	}
+
+	firingTask = xTaskGetCurrentTaskHandle();
+
+	// Entries still waiting in the list may be cancelled while the lock is released, which unlinks them from it
+	while(EventTimerEntry* entry = expiringEntries){
+		remove(entry);
+
+		firingEntry = entry;
+		firingList = entry->list;
+
+		lock.unlock();
+		entry->fire();
+		lock.lock();
+
+		firingEntry = nullptr;
+		EventTimerList* const list = std::exchange(firingList, nullptr);
+
+		// A detached entry was cancelled while running, and its event may not exist anymore
+		if(entry->list != nullptr && entry->period > 0){
+			entry->expiry += entry->period;
+			insert(entry);
+		}else{
+			if(entry->list != nullptr){
+				entries.erase(entry->id);
+				unlinkFromEvent(entry);
+			}
+
+			// The event may be destroyed as soon as the tasks waiting for the broadcast are woken up
+			if(list != nullptr){
+				list->count.fetch_sub(1, std::memory_order_relaxed);
+			}
+
+			entry->next = finishedEntries;
+			finishedEntries = entry;
+		}
+
+		++firedCount;
+		firedCondition.notify_all();
+	}
+}
+
+uint64_t EventTimer::nextWakeUp() const noexcept{
+	uint64_t wakeUp = NoWakeUp;
+
+	if(occupiedSlots[0] != 0){
+		wakeUp = nextTick + std::countr_zero(std::rotr(occupiedSlots[0], nextTick & SlotMask));
+	}
+
+	for(size_t level = 1; level < LevelCount; ++level){
+		if(occupiedSlots[level] == 0){
+			continue;
+		}
+
+		// Slots of higher levels are cascaded at the first tick of their range, starting with the first range which has not begun yet
+		const size_t shift = LevelBits * level;
+		const uint64_t firstRange = (nextTick + (1ull << shift) - 1) >> shift;
+		const uint64_t offset = std::countr_zero(std::rotr(occupiedSlots[level], firstRange & SlotMask));
+
+		wakeUp = std::min(wakeUp, (firstRange + offset) << shift);
+	}
+
+	return wakeUp;
+}
@@ -0,0 +1,243 @@
+#ifndef CMF_EVENTTIMER_H
+#define CMF_EVENTTIMER_H
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include "Entity/AsyncEntity.h"
+#include "Object/Class.h"
+
+/**
+ * @brief ID of a broadcast scheduled on the EventTimer, used to cancel it. 0 is never a valid ID.
+ */
+using EventTimerID = uint32_t;
+
+class EventTimerEntry;
+
+/**
+ * @brief The broadcasts of a single event scheduled on the EventTimer, held by the event.
+ * Entries are linked into the list of their event, so cancelling all broadcasts of an event does not search the broadcasts of other events.
+ */
+class EventTimerList {
+public:
+	/**
+	 * @return The number of scheduled broadcasts, including a cancelled one which is still running.
+	 */
+	inline uint32_t getCount() const noexcept { return count.load(std::memory_order_relaxed); }
+
+private:
+	friend class EventTimer;
+
+	// Guarded by the lock of the timer, the count is atomic so it can be checked without it
+	EventTimerEntry* first = nullptr;
+	std::atomic_uint32_t count = 0;
+};
+
+/**
+ * @brief A broadcast scheduled on the EventTimer, implemented by Event for its argument types.
+ * Entries are linked into the slots of the timer wheel directly, so scheduling and expiring one does not search the wheel.
+ */
+class EventTimerEntry {
+public:
+	/**
+	 * @brief Constructor of an entry broadcasting an event.
+	 * @param list The list of scheduled broadcasts of the event, kept up to date by the timer.
+	 */
+	inline explicit EventTimerEntry(EventTimerList& list) noexcept : list(&list) {}
+
+	/**
+	 * @brief Default virtual destructor.
+	 */
+	virtual ~EventTimerEntry() noexcept = default;
+
+	/**
+	 * @brief Broadcasts the event, called on the timer thread when the entry expires.
+	 */
+	virtual void fire() noexcept = 0;
+
+private:
+	friend class EventTimer;
+
+	// Cleared when the entry is cancelled while it is running, after which the timer does not touch the list through it
+	EventTimerList* list;
+	EventTimerEntry* previousOfEvent = nullptr;
+	EventTimerEntry* nextOfEvent = nullptr;
+
+	EventTimerEntry* previous = nullptr;
+	EventTimerEntry* next = nullptr;
+	uint64_t expiry = 0;
+	uint32_t period = 0;
+	EventTimerID id = 0;
+	uint8_t level = 0;
+	uint8_t slot = 0;
+};
+
+/**
+ * @brief Broadcasts events after a delay or periodically, for any number of scheduled broadcasts on a single thread.
+ * Scheduled broadcasts are kept in a hierarchical timer wheel of four levels of 64 slots, with one tick of the system clock per slot of the first level,
+ * so scheduling, cancelling and expiring a broadcast takes constant time regardless of how many are scheduled.
+ * Broadcasts further in the future are kept in the coarser levels and moved down as their time comes closer.
+ * The thread sleeps until the next expiring broadcast or level change, instead of waking up every tick.
+ * Broadcasts run without the lock of the wheel, so callbacks called directly on the timer thread can schedule and cancel broadcasts,
+ * and a callback blocking the timer thread does not block scheduling on other tasks.
+ * Created by the Application when CONFIG_CMF_EVENTTIMER is enabled, broadcasts are scheduled through the events themselves.
+ */
+class EventTimer : public AsyncEntity {
+	GENERATED_BODY(EventTimer, AsyncEntity, void)
+
+public:
+	/**
+	 * @brief Constructor of an empty timer.
+	 * @param internalStack If true the thread stack is allocated in internal SRAM.
+	 */
+	explicit EventTimer(bool internalStack = true);
+
+	/**
+	 * @brief Deletes all scheduled broadcasts.
+	 */
+	virtual ~EventTimer() override;
+
+	/**
+	 * @brief Schedules a broadcast. The timer takes over the entry and deletes it once it expired or was cancelled.
+	 * @param entry The entry broadcasting the event.
+	 * @param delay Time until the broadcast in milliseconds, rounded up to whole ticks.
+	 * @param period Time between repeated broadcasts in milliseconds, 0 broadcasts only once.
+	 * @return The ID of the scheduled broadcast, 0 if the entry is nullptr.
+	 */
+	EventTimerID schedule(EventTimerEntry* entry, uint32_t delay, uint32_t period = 0) noexcept;
+
+	/**
+	 * @brief Cancels a scheduled broadcast. A broadcast cancelled while it is running finishes, but is not repeated.
+	 * Called from any other task than the timer thread, waits for the running broadcast to finish.
+	 * @param id The ID of the scheduled broadcast.
+	 * @return True if the broadcast was scheduled, false if it already expired or was cancelled.
+	 */
+	bool cancel(EventTimerID id) noexcept;
+
+	/**
+	 * @brief Cancels all scheduled broadcasts of an event. Takes time proportional to the number of broadcasts scheduled for that event.
+	 * Called from any other task than the timer thread, waits for a running broadcast of the event to finish, so the event can be destroyed afterwards.
+	 * @param list The list of scheduled broadcasts of the event.
+	 */
+	void cancelAll(EventTimerList& list) noexcept;
+
+	/**
+	 * @return The number of scheduled broadcasts.
+	 */
+	size_t getScheduledCount() const noexcept;
+
+protected:
+	/**
+	 * @brief Sleeps until the next scheduled broadcast expires or an earlier one is scheduled, then broadcasts all expired ones.
+	 * @param deltaTime How much time has passed since the last tick call.
+	 */
+	virtual void tick(float deltaTime) noexcept override;
+
+private:
+	static constexpr size_t LevelBits = 6;
+	static constexpr size_t SlotCount = 1 << LevelBits;
+	static constexpr size_t LevelCount = 4;
+	static constexpr uint64_t SlotMask = SlotCount - 1;
+
+	// Broadcasts beyond the range of the wheel are kept in the last slot of the top level within the range, and placed again once it is reached
+	static constexpr uint64_t WheelRange = 1ull << (LevelBits * LevelCount);
+
+	static constexpr uint64_t NoWakeUp = UINT64_MAX;
+
+	std::array<std::array<EventTimerEntry*, SlotCount>, LevelCount> wheel = {};
+	std::array<uint64_t, LevelCount> occupiedSlots = {};
+	std::unordered_map<EventTimerID, EventTimerEntry*> entries;
+
+	// The next tick which has not been processed yet
+	uint64_t nextTick;
+	uint64_t plannedWakeUp = NoWakeUp;
+	EventTimerID nextID = 1;
+	EventTimerEntry* expiringEntries = nullptr;
+
+	// Entries which expired or were cancelled while running, linked through their next pointers and deleted once the lock is released
+	EventTimerEntry* finishedEntries = nullptr;
+
+	// The entry being broadcast without the lock, and the number of broadcasts which have finished, which tasks cancelling it wait on
+	// The entry is counted through the firing list until it returns, unless its event cancels all its broadcasts before
+	EventTimerEntry* firingEntry = nullptr;
+	EventTimerList* firingList = nullptr;
+	TaskHandle_t firingTask = nullptr;
+	uint32_t firedCount = 0;
+	std::condition_variable firedCondition;
+
+	mutable std::mutex wheelMutex;
+	SemaphoreHandle_t wakeSemaphore;
+
+private:
+	/**
+	 * @return The current time in ticks.
+	 */
+	static uint64_t currentTick() noexcept;
+
+	/**
+	 * @brief Links the entry into the slot its expiry falls into, relative to the next unprocessed tick.
+	 */
+	void insert(EventTimerEntry* entry) noexcept;
+
+	/**
+	 * @brief Unlinks the entry from its slot.
+	 */
+	void remove(EventTimerEntry* entry) noexcept;
+
+	/**
+	 * @brief Links the entry into the list of scheduled broadcasts of its event.
+	 */
+	static void linkToEvent(EventTimerEntry* entry) noexcept;
+
+	/**
+	 * @brief Unlinks the entry from the list of scheduled broadcasts of its event.
+	 */
+	static void unlinkFromEvent(EventTimerEntry* entry) noexcept;
+
+	/**
+	 * @brief Unlinks an entry already taken out of the scheduled entries, unless it is running, in which case it is deleted after it returns.
+	 * A running entry is detached from the list of its event right away, and stays counted through the list of the running broadcast.
+	 * @param released The list of entries to delete once the lock is released, the entry is added to it unless it is running.
+	 */
+	void release(EventTimerEntry* entry, EventTimerEntry*& released) noexcept;
+
+	/**
+	 * @brief Waits for the running broadcast to finish if it is the given entry, unless called from the timer thread itself.
+	 * @param lock The lock of the wheel, released while waiting.
+	 */
+	void waitForFiring(const EventTimerEntry* entry, std::unique_lock<std::mutex>& lock) noexcept;
+
+	/**
+	 * @brief Deletes a list of entries linked through their next pointers. Called without the lock, so the destructors of the entries can use the timer.
+	 */
+	static void deleteEntries(EventTimerEntry* list) noexcept;
+
+	/**
+	 * @brief Processes all ticks up to and including the given one, broadcasting expired entries and moving entries down the levels.
+	 * @param lock The lock of the wheel, released while broadcasting.
+	 */
+	void advance(uint64_t tick, std::unique_lock<std::mutex>& lock) noexcept;
+
+	/**
+	 * @brief Places all entries of a slot again, relative to the next unprocessed tick.
+	 */
+	void cascade(size_t level, size_t slot) noexcept;
+
+	/**
+	 * @brief Broadcasts all entries of a slot of the first level, and schedules the periodic ones again.
+	 * Entries are moved into the list of expiring entries under the lock, and broadcast one at a time with the lock released.
+	 * @param lock The lock of the wheel, released while broadcasting.
+	 */
+	void expire(size_t slot, std::unique_lock<std::mutex>& lock) noexcept;
+
+	/**
+	 * @return The first tick at which an occupied slot is expired or cascaded, NoWakeUp if the wheel is empty.
+	 */
+	uint64_t nextWakeUp() const noexcept;
+};
+
+#endif //CMF_EVENTTIMER_H
@@ -6,22 +6,19 @@
 
 DEFINE_LOG(CompressedFile)
 
-static constexpr uint8_t HEATSHRINK_WINDOW_SZ2 = 14;
-static constexpr uint8_t HEATSHRINK_LOOKAHEAD_SZ2 = 7;
-
-CompressedFile::CompressedFile(File source) : source(source), filePath(source ? source.name() : ""){
+CompressedFile::CompressedFile(File source, size_t offset, uint8_t windowSize, uint8_t lookaheadSize) : source(source), offset(offset), filePath(source ? source.name() : ""){
 	if(!source){
 		CMF_LOG(CompressedFile, LogLevel::Error, "Couldn't open source file: %s", source.name());
 		return;
 	}
 
-	hsd = heatshrink_decoder_alloc(InputBufSize, HEATSHRINK_WINDOW_SZ2, HEATSHRINK_LOOKAHEAD_SZ2);
+	hsd = heatshrink_decoder_alloc(InputBufSize, windowSize, lookaheadSize);
 	if(hsd == nullptr){
 		CMF_LOG(CompressedFile, LogLevel::Error, "Failed to allocate heatshrink decoder");
 		return;
 	}
 
-	source.seek(0, SeekMode::SeekSet);
+	source.seek(offset, SeekMode::SeekSet);
 }
 
 CompressedFile::~CompressedFile(){
@@ -31,8 +28,8 @@ CompressedFile::~CompressedFile(){
 	}
 }
 
-File CompressedFile::open(const File& source){
-	return { std::make_shared<CompressedFile>(source) };
+File CompressedFile::open(const File& source, size_t offset, uint8_t windowSize, uint8_t lookaheadSize){
+	return { std::make_shared<CompressedFile>(source, offset, windowSize, lookaheadSize) };
 }
 
 CompressedFile::operator bool(){
@@ -48,7 +45,7 @@ void CompressedFile::resetStream(){
 	if(hsd != nullptr){
 		heatshrink_decoder_reset(hsd);
 	}
-	source.seek(0, SeekMode::SeekSet);
+	source.seek(offset, SeekMode::SeekSet);
 	inPos = inLen = 0;
 	outPos = outLen = 0;
 	finished = false;
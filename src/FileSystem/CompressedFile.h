@@ -25,12 +25,21 @@ extern "C" {
  */
 class CompressedFile : public FileImpl {
 public:
-	explicit CompressedFile(File source);
+	static constexpr uint8_t DefaultWindowSize = 14;
+	static constexpr uint8_t DefaultLookaheadSize = 7;
+
+	/**
+	 * @param source     Compressed source file
+	 * @param offset     Position in the source where the compressed stream starts
+	 * @param windowSize Base-2 log of the window size the stream was compressed with
+	 * @param lookaheadSize Base-2 log of the lookahead size the stream was compressed with
+	 */
+	explicit CompressedFile(File source, size_t offset = 0, uint8_t windowSize = DefaultWindowSize, uint8_t lookaheadSize = DefaultLookaheadSize);
 	~CompressedFile() override;
 
 	operator bool() override;
 
-	static File open(const File& source);
+	static File open(const File& source, size_t offset = 0, uint8_t windowSize = DefaultWindowSize, uint8_t lookaheadSize = DefaultLookaheadSize);
 	void close() override;
 
 	size_t size() const override;
@@ -48,6 +57,7 @@ private:
 	static constexpr size_t OutputBufSize = 1024;
 
 	File source;
+	size_t offset = 0;
 	heatshrink_decoder* hsd = nullptr;
 	std::string filePath;
 
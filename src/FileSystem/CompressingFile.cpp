@@ -0,0 +1,131 @@
+#include "CompressingFile.h"
+
+#include "Log/Log.h"
+
+DEFINE_LOG(CompressingFile)
+
+CompressingFile::CompressingFile(File destination, uint8_t windowSize, uint8_t lookaheadSize) : destination(destination), filePath(destination ? destination.name() : ""){
+	if(!destination){
+		CMF_LOG(CompressingFile, LogLevel::Error, "Couldn't open destination file: %s", destination.name());
+		return;
+	}
+
+	hse = heatshrink_encoder_alloc(windowSize, lookaheadSize);
+	if(hse == nullptr){
+		CMF_LOG(CompressingFile, LogLevel::Error, "Failed to allocate heatshrink encoder");
+		return;
+	}
+}
+
+CompressingFile::~CompressingFile(){
+	finish();
+
+	if(hse != nullptr){
+		heatshrink_encoder_free(hse);
+		hse = nullptr;
+	}
+}
+
+File CompressingFile::open(const File& destination, uint8_t windowSize, uint8_t lookaheadSize){
+	return { std::make_shared<CompressingFile>(destination, windowSize, lookaheadSize) };
+}
+
+CompressingFile::operator bool(){
+	return hse != nullptr && destination;
+}
+
+void CompressingFile::close(){
+	finish();
+	destination.close();
+	filePath = "";
+}
+
+bool CompressingFile::finish(){
+	if(finished || hse == nullptr) return !encodeError;
+
+	while(!encodeError){
+		HSE_finish_res fres = heatshrink_encoder_finish(hse);
+		if(fres < 0){ // HSER_FINISH_ERROR_*
+			CMF_LOG(CompressingFile, LogLevel::Error, "Encode finish error (%d): %s", fres, filePath.c_str());
+			encodeError = true;
+			break;
+		}
+
+		drain();
+		if(fres == HSER_FINISH_DONE) break;
+	}
+
+	finished = true;
+	destination.flush();
+
+	return !encodeError;
+}
+
+void CompressingFile::drain(){
+	while(!encodeError){
+		size_t polled = 0;
+		HSE_poll_res pres = heatshrink_encoder_poll(hse, outBuf, OutputBufSize, &polled);
+		if(pres < 0){ // HSER_POLL_ERROR_*
+			CMF_LOG(CompressingFile, LogLevel::Error, "Encode poll error (%d): %s", pres, filePath.c_str());
+			encodeError = true;
+			return;
+		}
+
+		if(polled > 0 && destination.write(outBuf, polled) != polled){
+			CMF_LOG(CompressingFile, LogLevel::Error, "Write failed: %s", filePath.c_str());
+			encodeError = true;
+			return;
+		}
+
+		if(pres == HSER_POLL_EMPTY) return;
+	}
+}
+
+size_t CompressingFile::write(const uint8_t* buf, size_t size){
+	if(hse == nullptr || finished || encodeError) return 0;
+
+	size_t consumed = 0;
+	while(consumed < size && !encodeError){
+		size_t sunk = 0;
+		HSE_sink_res sres = heatshrink_encoder_sink(hse, const_cast<uint8_t*>(buf) + consumed, size - consumed, &sunk);
+		if(sres < 0){ // HSER_SINK_ERROR_*
+			CMF_LOG(CompressingFile, LogLevel::Error, "Encode sink error (%d): %s", sres, filePath.c_str());
+			encodeError = true;
+			break;
+		}
+
+		consumed += sunk;
+		drain(); // the encoder only accepts more input once its output is drained
+	}
+
+	cursor += consumed;
+	return consumed;
+}
+
+void CompressingFile::flush(){
+	// The encoder can't be flushed without ending the stream, so only the already compressed output is flushed
+	destination.flush();
+}
+
+size_t CompressingFile::read([[maybe_unused]] uint8_t* dest, [[maybe_unused]] size_t len){
+	return 0;
+}
+
+bool CompressingFile::seek(int pos, int whence){
+	if((whence == SEEK_SET && pos >= 0 && (size_t) pos == cursor) || (whence == SEEK_CUR && pos == 0)) return true;
+
+	CMF_LOG(CompressingFile, LogLevel::Warning, "Seek unsupported on compressing stream: %s", filePath.c_str());
+	return false;
+}
+
+size_t CompressingFile::size() const{
+	return cursor;
+}
+
+const char* CompressingFile::name() const{
+	return filePath.c_str();
+}
+
+size_t CompressingFile::pos() const{
+	return cursor;
+}
@@ -0,0 +1,76 @@
+#ifndef CMF_COMPRESSINGFILE_H
+#define CMF_COMPRESSINGFILE_H
+
+#include <cstdint>
+#include <string>
+#include "FileImpl.h"
+#include "File.h"
+#include "CompressedFile.h"
+
+extern "C" {
+#include <heatshrink_encoder.h>
+}
+
+/**
+ * @brief A forward-streaming heatshrink compressor exposed as a File, the encoding counterpart of CompressedFile.
+ *
+ * Bytes written to it are compressed on the fly and written to the destination File, holding only the encoder
+ * window + a small output buffer. The encoder needs roughly 2 * 2^windowSize bytes for its window, plus twice that
+ * for the match index, so smaller windows than the CompressedFile default are a better fit for data compressed on device.
+ *
+ * Writes are sequential and the stream can't be read or seeked. The stream has to be finished for the tail of the
+ * data to reach the destination: finish() does so explicitly, close() finishes and closes the destination, and the
+ * destructor finishes as a fallback. size() and pos() report the number of uncompressed bytes written.
+ */
+class CompressingFile : public FileImpl {
+public:
+	/**
+	 * @param destination   File the compressed stream is written to, starting at its current position
+	 * @param windowSize    Base-2 log of the window size
+	 * @param lookaheadSize Base-2 log of the lookahead size
+	 */
+	explicit CompressingFile(File destination, uint8_t windowSize = CompressedFile::DefaultWindowSize, uint8_t lookaheadSize = CompressedFile::DefaultLookaheadSize);
+	~CompressingFile() override;
+
+	operator bool() override;
+
+	static File open(const File& destination, uint8_t windowSize = CompressedFile::DefaultWindowSize, uint8_t lookaheadSize = CompressedFile::DefaultLookaheadSize);
+	void close() override;
+
+	/**
+	 * @brief Compresses and writes out everything still held by the encoder. Nothing can be written afterwards.
+	 * @return False if compressing or writing to the destination failed at any point.
+	 */
+	bool finish();
+
+	size_t size() const override;
+	const char* name() const override;
+
+	size_t read(uint8_t* dest, size_t len) override;
+	size_t write(const uint8_t* buf, size_t size) override;
+	void flush() override;
+
+	bool seek(int pos, int whence) override;
+	size_t pos() const override;
+
+private:
+	static constexpr size_t OutputBufSize = 256;
+
+	File destination;
+	heatshrink_encoder* hse = nullptr;
+	std::string filePath;
+
+	uint8_t outBuf[OutputBufSize];
+
+	// Is encoder done
+	bool finished = false;
+	// Encoder or destination reported an error; the stream is truncated
+	bool encodeError = false;
+	// Uncompressed bytes written
+	size_t cursor = 0;
+
+	// Writes all output pending in the encoder to the destination
+	void drain();
+};
+
+#endif //CMF_COMPRESSINGFILE_H
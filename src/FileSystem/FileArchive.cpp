@@ -0,0 +1,247 @@
+#include "FileArchive.h"
+#include "CompressedFile.h"
+#include "CompressingFile.h"
+#include <algorithm>
+#include <cstring>
+
+// Small window, since the encoder needs several times the window size in RAM
+static constexpr uint8_t CompressionWindowSize = 10;
+static constexpr uint8_t CompressionLookaheadSize = 4;
+
+// Uncompressed length, window size, lookahead size
+static constexpr size_t CompressionHeaderSize = sizeof(uint32_t) + 2;
+
+FileInArchive::FileInArchive(const File& file, FileCompression compression) noexcept : file(file), start(file.position()) {
+	if(compression != FileCompression::Heatshrink){
+		return;
+	}
+
+	destination = file;
+	headerPosition = file.position();
+
+	// The length is filled in by finish()
+	uint8_t header[CompressionHeaderSize] = { 0 };
+	header[sizeof(uint32_t)] = CompressionWindowSize;
+	header[sizeof(uint32_t) + 1] = CompressionLookaheadSize;
+	if(destination.write(header, sizeof(header)) != sizeof(header)){
+		writeFailed = true;
+	}
+
+	compressor = std::make_shared<CompressingFile>(destination, CompressionWindowSize, CompressionLookaheadSize);
+	if(!*compressor){
+		writeFailed = true;
+	}
+
+	this->file = File(compressor);
+	start = 0;
+}
+
+FileInArchive::~FileInArchive() noexcept {
+	finish();
+}
+
+size_t FileInArchive::size() const noexcept {
+	return written + buffered;
+}
+
+void FileInArchive::flush() noexcept {
+	if(buffered == 0){
+		return;
+	}
+
+	if(file.write(buffer, buffered) != buffered){
+		writeFailed = true;
+	}
+
+	written += buffered;
+	buffered = 0;
+}
+
+void FileInArchive::finish() noexcept {
+	flush();
+
+	if(compressor == nullptr){
+		return;
+	}
+
+	if(!compressor->finish()){
+		writeFailed = true;
+	}
+
+	uint8_t length[sizeof(uint32_t)];
+	encodeSectionLength(written, length);
+
+	const size_t end = destination.position();
+	destination.seek(headerPosition, SeekMode::SeekSet);
+	if(destination.write(length, sizeof(length)) != sizeof(length)){
+		writeFailed = true;
+	}
+	destination.seek(end, SeekMode::SeekSet);
+
+	compressor.reset();
+	file = File();
+}
+
+void FileInArchive::pushBytes(const uint8_t* data, size_t count) noexcept {
+	if(data == nullptr || count == 0){
+		return;
+	}
+
+	if(count > BufferSize - buffered){
+		flush();
+	}
+
+	if(count >= BufferSize){
+		if(file.write(data, count) != count){
+			writeFailed = true;
+		}
+
+		written += count;
+		return;
+	}
+
+	memcpy(buffer + buffered, data, count);
+	buffered += count;
+}
+
+void FileInArchive::patchBytes(size_t position, const uint8_t* data, size_t count) noexcept {
+	if(data == nullptr || position + count > size()){
+		return;
+	}
+
+	if(position >= written){
+		memcpy(buffer + (position - written), data, count);
+		return;
+	}
+
+	// Compressed data can not be changed anymore
+	if(compressor != nullptr){
+		writeFailed = true;
+		return;
+	}
+
+	flush();
+
+	file.seek(start + position, SeekMode::SeekSet);
+	if(file.write(data, count) != count){
+		writeFailed = true;
+	}
+	file.seek(start + written, SeekMode::SeekSet);
+}
+
+FileOutArchive::FileOutArchive(const File& file, size_t length) noexcept : file(file), start(file.position()), length(length) {
+	if(this->length == 0 && file.size() > start){
+		this->length = file.size() - start;
+	}
+}
+
+FileOutArchive::FileOutArchive(const File& file, FileCompression compression) noexcept : file(file), start(file.position()) {
+	if(compression != FileCompression::Heatshrink){
+		if(file.size() > start){
+			length = file.size() - start;
+		}
+
+		return;
+	}
+
+	File source = file;
+	uint8_t header[CompressionHeaderSize];
+	if(source.read(header, sizeof(header)) != sizeof(header)){
+		return;
+	}
+
+	length = decodeSectionLength(header);
+	this->file = CompressedFile::open(source, source.position(), header[sizeof(uint32_t)], header[sizeof(uint32_t) + 1]);
+	start = 0;
+
+	if(!this->file){
+		length = 0;
+	}
+}
+
+size_t FileOutArchive::size() const noexcept {
+	return length - tell();
+}
+
+bool FileOutArchive::popBytes(uint8_t* data, size_t count) noexcept {
+	if(count > size()){
+		return false;
+	}
+
+	// Restored when the file turns out to be shorter than the archive, so the caller can rewind
+	const size_t position = tell();
+
+	size_t copied = std::min(count, bufferLen - bufferPos);
+	memcpy(data, buffer + bufferPos, copied);
+	bufferPos += copied;
+
+	if(copied == count){
+		return true;
+	}
+
+	const size_t remaining = count - copied;
+	if(remaining >= BufferSize){
+		size_t got = file.read(data + copied, remaining);
+		if(got == (size_t) -1){
+			got = 0;
+		}
+
+		bufferStart += bufferLen + got;
+		bufferPos = bufferLen = 0;
+
+		if(got != remaining){
+			// The file ended before the archive did, nothing more can be read from it
+			length = tell();
+			seekTo(position);
+			return false;
+		}
+
+		return true;
+	}
+
+	if(!fill() || bufferLen < remaining){
+		length = bufferStart + bufferLen;
+		seekTo(position);
+		return false;
+	}
+
+	memcpy(data + copied, buffer, remaining);
+	bufferPos = remaining;
+
+	return true;
+}
+
+const uint8_t* FileOutArchive::viewBytes([[maybe_unused]] size_t count) noexcept {
+	return nullptr;
+}
+
+size_t FileOutArchive::tell() const noexcept {
+	return bufferStart + bufferPos;
+}
+
+void FileOutArchive::seekTo(size_t cursor) noexcept {
+	cursor = std::min(cursor, length);
+
+	if(cursor >= bufferStart && cursor <= bufferStart + bufferLen){
+		bufferPos = cursor - bufferStart;
+		return;
+	}
+
+	file.seek(start + cursor, SeekMode::SeekSet);
+	bufferStart = cursor;
+	bufferPos = bufferLen = 0;
+}
+
+bool FileOutArchive::fill() noexcept {
+	bufferStart += bufferLen;
+	bufferPos = 0;
+
+	size_t got = file.read(buffer, std::min(BufferSize, length - bufferStart));
+	if(got == (size_t) -1){
+		got = 0;
+	}
+
+	bufferLen = got;
+
+	return got > 0;
+}
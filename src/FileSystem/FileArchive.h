@@ -0,0 +1,171 @@
+#ifndef CMF_FILEARCHIVE_H
+#define CMF_FILEARCHIVE_H
+
+#include <cstdint>
+#include <memory>
+#include "Containers/Archive.h"
+#include "FileSystem/File.h"
+
+/**
+ * @brief Compression applied to the archive data stored in a file.
+ * Heatshrink compresses the data on the fly with a small window, and prefixes it with a header holding
+ * the uncompressed length and the compression parameters, so the reading side needs no further information.
+ * Typical saved state shrinks to 55-70% of its size, but writing is several times slower, bound by the match search of the encoder,
+ * and reading takes about twice as long, so it suits data which is stored rarely and is large compared to the storage it lives on.
+ */
+enum class FileCompression : uint8_t {
+	None,
+	Heatshrink
+};
+
+/**
+ * @brief An in-only archive which streams its data directly into a File instead of keeping it in memory.
+ * Data is gathered in a small fixed staging buffer and written to the file once the buffer fills up,
+ * so serializing through it takes constant memory regardless of the amount of data.
+ * Byte array conversion functions are not applicable, since the data ends up in the file.
+ */
+class FileInArchive : public InArchive {
+public:
+	/**
+	 * @brief Constructor which starts writing to the given file at its current position.
+	 * @param file The file the archive data is written to.
+	 * @param compression The compression applied to the data. When compressed, sections can only be used
+	 * as long as they fit in the staging buffer, since data which already left it can not be patched.
+	 */
+	FileInArchive(const File& file, FileCompression compression = FileCompression::None) noexcept;
+
+	/**
+	 * @brief Destructor which finishes the archive, see finish().
+	 */
+	virtual ~FileInArchive() noexcept override;
+
+	/**
+	 * @return The number of bytes written into the archive so far.
+	 */
+	virtual size_t size() const noexcept override;
+
+	/**
+	 * @brief Writes out the data left in the staging buffer to the file.
+	 */
+	void flush() noexcept;
+
+	/**
+	 * @brief Writes out all remaining data, and completes the compressed stream if the archive is compressed.
+	 * Nothing can be pushed to a compressed archive afterwards.
+	 */
+	void finish() noexcept;
+
+	/**
+	 * @return True if any of the writes to the file failed, false otherwise.
+	 */
+	inline bool failed() const noexcept { return writeFailed; }
+
+protected:
+	/**
+	 * @brief Appends a block of bytes to the staging buffer, writing it out to the file when it fills up.
+	 * Blocks larger than the staging buffer are written to the file directly.
+	 * @param data Pointer to the bytes being pushed.
+	 * @param count Number of bytes being pushed.
+	 */
+	virtual void pushBytes(const uint8_t* data, size_t count) noexcept override;
+
+	/**
+	 * @brief Overwrites a block of bytes that was already pushed, either in the staging buffer or in the file.
+	 * @param position Position of the first byte being overwritten, relative to where the archive started writing.
+	 * @param data Pointer to the new bytes.
+	 * @param count Number of bytes being overwritten.
+	 */
+	virtual void patchBytes(size_t position, const uint8_t* data, size_t count) noexcept override;
+
+private:
+	static constexpr size_t BufferSize = 128;
+
+	File file;
+	size_t start = 0;
+	uint8_t buffer[BufferSize];
+	size_t buffered = 0;
+	size_t written = 0;
+	bool writeFailed = false;
+
+	File destination;
+	std::shared_ptr<class CompressingFile> compressor;
+	size_t headerPosition = 0;
+};
+
+/**
+ * @brief An out-only archive which streams its data directly from a File instead of keeping it in memory.
+ * Data is read from the file in blocks into a small fixed staging buffer, so de-serializing through it
+ * takes constant memory regardless of the amount of data. Views into the data are not supported.
+ */
+class FileOutArchive : public OutArchive {
+public:
+	/**
+	 * @brief Constructor which starts reading from the given file at its current position.
+	 * @param file The file the archive data is read from.
+	 * @param length The number of bytes of archive data in the file. If 0, everything from the current position
+	 * until the end of the file is used. Has to be given for files which do not know their size up front, such as CompressedFile.
+	 */
+	FileOutArchive(const File& file, size_t length = 0) noexcept;
+
+	/**
+	 * @brief Constructor which starts reading from the given file at its current position.
+	 * @param file The file the archive data is read from.
+	 * @param compression The compression the data was written with.
+	 */
+	FileOutArchive(const File& file, FileCompression compression) noexcept;
+
+	/**
+	 * @return The number of bytes in the archive that have not been read yet.
+	 */
+	virtual size_t size() const noexcept override;
+
+protected:
+	/**
+	 * @brief Copies a block of bytes out of the staging buffer, refilling it from the file as needed.
+	 * Blocks larger than the staging buffer are read from the file directly.
+	 * Nothing is consumed if fewer than count bytes are available. If the file ends before the archive does,
+	 * the archive is shortened to the data the file holds and the read position is restored.
+	 * @param data Pointer to the memory the bytes are copied to.
+	 * @param count Number of bytes being popped.
+	 * @return True if successful, false otherwise.
+	 */
+	virtual bool popBytes(uint8_t* data, size_t count) noexcept override;
+
+	/**
+	 * @brief Views are not supported since the data is not kept in memory.
+	 * @param count Number of bytes being viewed.
+	 * @return Always nullptr.
+	 */
+	virtual const uint8_t* viewBytes(size_t count) noexcept override;
+
+	/**
+	 * @return The number of bytes read out of the archive so far.
+	 */
+	virtual size_t tell() const noexcept override;
+
+	/**
+	 * @brief Moves the read position to the given position, used both for rewinding and for skipping data.
+	 * Positions within the staging buffer are restored without touching the file.
+	 * @param cursor The read position.
+	 */
+	virtual void seekTo(size_t cursor) noexcept override;
+
+private:
+	static constexpr size_t BufferSize = 128;
+
+	File file;
+	size_t start = 0;
+	size_t length = 0;
+	uint8_t buffer[BufferSize];
+	size_t bufferStart = 0;
+	size_t bufferPos = 0;
+	size_t bufferLen = 0;
+
+	/**
+	 * @brief Refills the staging buffer from the file at the current read position.
+	 * @return True if any data was read, false otherwise.
+	 */
+	bool fill() noexcept;
+};
+
+#endif //CMF_FILEARCHIVE_H
@@ -0,0 +1,119 @@
+#include "ObjectGraph.h"
+#include "Memory/ObjectMemory.h"
+
+// Each object occurrence starts with a tag: null, a new object record, or a back-reference to an already stored object
+static constexpr uint32_t NullTag = 0;
+static constexpr uint32_t ObjectTag = 1;
+static constexpr uint32_t FirstIndexTag = 2;
+
+void GraphInArchive::writeObject(Object* object) noexcept {
+	if(object == nullptr){
+		pushData<uint32_t>(NullTag);
+		return;
+	}
+
+	if(auto it = indices.find(object); it != indices.end()){
+		pushData<uint32_t>(FirstIndexTag + it->second);
+		return;
+	}
+
+	indices.emplace(object, (uint32_t) indices.size());
+
+	pushData<uint32_t>(ObjectTag);
+	pushData<uint64_t>(object->getStaticClass()->getID());
+
+	object->serialize(*this);
+
+	std::vector<Object*> children;
+	children.reserve(object->getChildCount());
+	object->forEachChild([&children](Object* child) -> bool {
+		children.push_back(child);
+		return false;
+	});
+
+	pushLength(children.size());
+	for(Object* child : children){
+		writeObject(child);
+	}
+}
+
+bool GraphInArchive::objectReference(Object*& object) noexcept {
+	writeObject(object);
+	return true;
+}
+
+GraphOutArchive::GraphOutArchive(std::span<const uint8_t> data) noexcept {
+	borrow(data);
+}
+
+StrongObjectPtr<Object> GraphOutArchive::readObject(Object* owner) noexcept {
+	Object* object = nullptr;
+	if(!readRecord(owner, object)){
+		return nullptr;
+	}
+
+	return object;
+}
+
+bool GraphOutArchive::objectReference(Object*& object) noexcept {
+	return readRecord(nullptr, object);
+}
+
+bool GraphOutArchive::readRecord(Object* owner, Object*& object) noexcept {
+	object = nullptr;
+
+	uint32_t tag = 0;
+	if(!popData<uint32_t>(tag)){
+		return false;
+	}
+
+	if(tag == NullTag){
+		return true;
+	}
+
+	if(tag >= FirstIndexTag){
+		const size_t index = tag - FirstIndexTag;
+		if(index >= objects.size()){
+			return false;
+		}
+
+		object = objects[index].get();
+		return true;
+	}
+
+	uint64_t classID = 0;
+	if(tag != ObjectTag || !popData<uint64_t>(classID)){
+		return false;
+	}
+
+	StrongObjectPtr<Object> created = newObject<Object>(Class::getClasByID(classID), owner);
+	if(!created.isValid()){
+		return false;
+	}
+
+	// Registered before its data is read, so references back to it from within resolve to the same instance
+	objects.push_back(created);
+
+	created->serialize(*this);
+
+	size_t childCount = 0;
+	if(!popLength(childCount, 1)){
+		return false;
+	}
+
+	for(size_t i = 0; i < childCount; ++i){
+		Object* child = nullptr;
+		if(!readRecord(created.get(), child)){
+			return false;
+		}
+
+		// Children first read through a reference were created without an owner
+		if(child != nullptr && child->getOwner() != created.get()){
+			child->setOwner(created.get());
+		}
+	}
+
+	object = created.get();
+
+	return true;
+}
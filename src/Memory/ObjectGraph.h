@@ -0,0 +1,117 @@
+#ifndef CMF_OBJECTGRAPH_H
+#define CMF_OBJECTGRAPH_H
+
+#include <unordered_map>
+#include <vector>
+#include "Containers/Archive.h"
+#include "Memory/Cast.h"
+#include "Memory/SmartPtr/StrongObjectPtr.h"
+
+/**
+ * @brief An in-only archive which serializes a whole object graph: an object, its children and every object referenced through
+ * Archive::objectReference(). Each object is written only once, every further occurrence is written as a back-reference by index.
+ * Each object record consists of a tag, the class ID, the data written by its serialize function, and its children.
+ */
+class GraphInArchive : public InArchive {
+public:
+	/**
+	 * @brief Default empty constructor.
+	 */
+	GraphInArchive() noexcept = default;
+
+	/**
+	 * @brief Writes the given object together with its children and referenced objects.
+	 * @param object The object being written. Can be nullptr.
+	 */
+	void writeObject(Object* object) noexcept;
+
+	/**
+	 * @brief Writes a reference to the given object. The object is written in full the first time it is referenced.
+	 * @param object The referenced object.
+	 * @return Always true.
+	 */
+	virtual bool objectReference(Object*& object) noexcept override;
+
+private:
+	std::unordered_map<const Object*, uint32_t> indices;
+};
+
+/**
+ * @brief An out-only archive which de-serializes an object graph written by GraphInArchive in a single pass.
+ * Objects are created through their class IDs, and all back-references resolve to the same instance.
+ * The archive keeps every created object alive for as long as it exists.
+ */
+class GraphOutArchive : public OutArchive {
+public:
+	/**
+	 * @brief Default empty constructor.
+	 */
+	GraphOutArchive() noexcept = default;
+
+	/**
+	 * @brief Constructor which reads directly from the given data instead of copying it.
+	 * @param data The data containing the object graph. Has to outlive the archive.
+	 */
+	explicit GraphOutArchive(std::span<const uint8_t> data) noexcept;
+
+	/**
+	 * @brief Reads an object together with its children and referenced objects.
+	 * @param owner The owner given to the object, if it was not read before.
+	 * @return Strong object pointer to the read object, nullptr if the data did not describe a valid object.
+	 */
+	StrongObjectPtr<Object> readObject(Object* owner = nullptr) noexcept;
+
+	/**
+	 * @brief Reads an object of type T together with its children and referenced objects.
+	 * @tparam T Type of object being read.
+	 * @param owner The owner given to the object, if it was not read before.
+	 * @return Strong object pointer to the read object, nullptr if the data did not describe a valid object of type T.
+	 */
+	template<typename T, typename = std::enable_if<std::derived_from<T, Object>, T>::type>
+	inline StrongObjectPtr<T> readObject(Object* owner = nullptr) noexcept {
+		return cast<T>(readObject(owner).get());
+	}
+
+	/**
+	 * @brief Reads a reference to an object, reading the whole object if it was not read before.
+	 * @param object The variable being set to the referenced object.
+	 * @return True if successful, false if the reference is invalid.
+	 */
+	virtual bool objectReference(Object*& object) noexcept override;
+
+private:
+	std::vector<StrongObjectPtr<Object>> objects;
+
+	/**
+	 * @brief Reads an object record or a back-reference.
+	 * @param owner The owner given to a newly created object.
+	 * @param object The variable being set to the read object.
+	 * @return True if successful, false otherwise.
+	 */
+	bool readRecord(Object* owner, Object*& object) noexcept;
+};
+
+/**
+ * @brief Writes / reads a reference to another object from within a serialize function.
+ * Archives which do not serialize whole object graphs do not support references, in which case nothing is written or read.
+ * @tparam T Type of the referenced object.
+ * @tparam KeepAlive Marks the type of smart pointer holding the reference.
+ * @param archive The archive being serialized to / de-serialized from.
+ * @param object The reference being written / set.
+ * @return True if successful, false otherwise.
+ */
+template<typename T, bool KeepAlive>
+inline bool serializeReference(Archive& archive, ObjectPtr<T, KeepAlive>& object) noexcept {
+	Object* pointer = object.get();
+	if(!archive.objectReference(pointer)){
+		return false;
+	}
+
+	if(pointer != object.get()){
+		object = cast<T>(pointer);
+	}
+
+	return true;
+}
+
+#endif //CMF_OBJECTGRAPH_H
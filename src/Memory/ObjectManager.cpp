@@ -66,6 +66,55 @@ void ObjectManager::unregisterReference(Object** object, bool keepAlive/* = fals
 	}
 }
 
+bool ObjectManager::moveReference(Object** from, Object** to) noexcept{
+	std::lock_guard lock(mutex);
+
+	auto it = objectReferenceMap.find(*from);
+	if(it == objectReferenceMap.end()){
+		return false;
+	}
+
+	// Reusing the node of the old location avoids allocating a new one
+	auto node = it->second.objectPointers.extract(from);
+	if(node.empty()){
+		return false;
+	}
+
+	*to = *from;
+	*from = nullptr;
+
+	node.value() = to;
+	it->second.objectPointers.insert(std::move(node));
+
+	return true;
+}
+
+Object* ObjectManager::acquireReference(Object* const* object) noexcept{
+	std::lock_guard lock(mutex);
+
+	auto it = objectReferenceMap.find(*object);
+	if(it == objectReferenceMap.end() || it->first == nullptr || it->second.count == 0){
+		return nullptr;
+	}
+
+	it->second.count++;
+
+	return it->first;
+}
+
+void ObjectManager::releaseReference(Object* object) noexcept{
+	std::lock_guard lock(mutex);
+
+	auto it = objectReferenceMap.find(object);
+	if(it == objectReferenceMap.end()){
+		return;
+	}
+
+	if(it->second.count > 0){
+		it->second.count--;
+	}
+}
+
 void ObjectManager::forEachObject(const std::function<bool(Object*)>& fn) noexcept{
 	if(fn == nullptr){
 		return;
@@ -54,6 +54,29 @@ public:
 	 */
 	void unregisterReference(Object** object, bool keepAlive = false) noexcept;
 
+	/**
+	 * @brief Moves a registered reference to a new pointer location, keeping its type and the reference count unchanged.
+	 * Unlike registering the new location and unregistering the old one, this needs no memory allocation.
+	 * @param from Pointer to the registered object pointer being moved, which is set to nullptr.
+	 * @param to Pointer to the object pointer taking over the reference, which is set to the referenced object.
+	 * @return True if the reference was moved, false if the object pointer at the old location is not registered.
+	 */
+	bool moveReference(Object** from, Object** to) noexcept;
+
+	/**
+	 * @brief Takes a strong reference to the object the given object pointer points to, without registering a new pointer.
+	 * The pointer is read under the lock, so an object being deleted at the same time is either referenced before it is deleted or not at all.
+	 * @param object Pointer to the registered object pointer being read.
+	 * @return The referenced object, or nullptr if it is not valid. Has to be given back with releaseReference unless nullptr.
+	 */
+	Object* acquireReference(Object* const* object) noexcept;
+
+	/**
+	 * @brief Gives back a strong reference taken with acquireReference.
+	 * @param object The referenced object.
+	 */
+	void releaseReference(Object* object) noexcept;
+
 	/**
 	 * @brief Iterated through all managed objects and calls the given callback function for each until the callback returns true.
 	 * @param fn The callback function being executed for each object until true is returned.
@@ -10,6 +10,9 @@
 #include "ObjectManager.h"
 #include "Object/Class.h"
 #include "Object/Interface.h"
+#include "FileSystem/FileArchive.h"
+#include "Containers/CountingArchive.h"
+#include "Memory/ObjectGraph.h"
 
 /**
  * @brief Initialization function, used to set the owner of the object, as well as call the postInitProperties of the object.
@@ -128,15 +131,14 @@ inline StrongObjectPtr<T> newObject(Object* owner = nullptr, Args&&... args) noe
 }
 
 /**
- * @brief De-serializes an object of type T from a byte array with a given owner.
+ * @brief De-serializes an object of type T from an archive with a given owner.
  * @tparam T Type of object being de-serialized.
- * @param data Byte array containing information about the object.
+ * @param archive Archive containing information about the object, starting with its class ID.
  * @param owner Owner being set to the created object.
- * @return The newly created object.
+ * @return Strong object pointer to the created object, nullptr if the data did not describe a valid object.
  */
 template<typename T, typename = std::enable_if<std::derived_from<T, Object>, T>::type>
-inline StrongObjectPtr<T> objectFromByteArray(std::span<const uint8_t> data, Object* owner = nullptr) noexcept {
-	OutArchive archive(data);
+inline StrongObjectPtr<T> objectFromArchive(OutArchive& archive, Object* owner = nullptr) noexcept {
 	uint64_t classID = 0;
 	archive << classID;
 
@@ -150,6 +152,19 @@ inline StrongObjectPtr<T> objectFromByteArray(std::span<const uint8_t> data, Obj
 	return object;
 }
 
+/**
+ * @brief De-serializes an object of type T from a byte array with a given owner.
+ * @tparam T Type of object being de-serialized.
+ * @param data Byte array containing information about the object.
+ * @param owner Owner being set to the created object.
+ * @return The newly created object.
+ */
+template<typename T, typename = std::enable_if<std::derived_from<T, Object>, T>::type>
+inline StrongObjectPtr<T> objectFromByteArray(std::span<const uint8_t> data, Object* owner = nullptr) noexcept {
+	OutArchive archive = OutArchive::view(data);
+	return objectFromArchive<T>(archive, owner);
+}
+
 /**
  * @brief De-serializes an object of type T from a byte array with a given owner.
  * @tparam T Type of object being de-serialized.
@@ -163,7 +178,7 @@ inline bool objectFromByteArray(T* object, std::span<const uint8_t> data) noexce
 		return false;
 	}
 
-	OutArchive archive(data);
+	OutArchive archive = OutArchive::view(data);
 	uint64_t classID = 0;
 	archive << classID;
 
@@ -191,12 +206,101 @@ inline void byteArrayFromObject(Object* object, std::vector<uint8_t>& data) noex
 		return;
 	}
 
+	// Measure first, so the buffer is allocated exactly once
+	CountingArchive counter;
+	counter << object->getStaticClass()->getID();
+	object->serialize(counter);
+
 	InArchive archive;
+	archive.reserve(counter.size());
 	archive << object->getStaticClass()->getID();
 
 	object->serialize(archive);
 
-	archive.toByteArray(data);
+	archive.takeByteArray(data);
+}
+
+/**
+ * @brief De-serializes an object of type T from a file with a given owner.
+ * The data is streamed from the file, so it is never held in memory as a whole.
+ * @tparam T Type of object being de-serialized.
+ * @param file File containing information about the object, read from its current position.
+ * @param owner Owner being set to the created object.
+ * @param length Number of bytes of object data in the file, 0 to use the rest of the file.
+ * @return Strong object pointer to the created object, nullptr if the data did not describe a valid object.
+ */
+template<typename T, typename = std::enable_if<std::derived_from<T, Object>, T>::type>
+inline StrongObjectPtr<T> objectFromFile(const File& file, Object* owner = nullptr, size_t length = 0) noexcept {
+	FileOutArchive archive(file, length);
+	return objectFromArchive<T>(archive, owner);
+}
+
+/**
+ * @brief De-serializes an object of type T from a file written with the given compression, with a given owner.
+ * The data is decompressed while it is streamed from the file, so it is never held in memory as a whole.
+ * @tparam T Type of object being de-serialized.
+ * @param file File containing information about the object, read from its current position.
+ * @param compression The compression the object was written with.
+ * @param owner Owner being set to the created object.
+ * @return Strong object pointer to the created object, nullptr if the data did not describe a valid object.
+ */
+template<typename T, typename = std::enable_if<std::derived_from<T, Object>, T>::type>
+inline StrongObjectPtr<T> objectFromFile(const File& file, FileCompression compression, Object* owner = nullptr) noexcept {
+	FileOutArchive archive(file, compression);
+	return objectFromArchive<T>(archive, owner);
+}
+
+/**
+ * @brief Serializes the given object directly to a file by streaming it through a file archive.
+ * @param object The object being serialized.
+ * @param file File the data is written to, starting at its current position.
+ * @param compression The compression applied to the data while it is streamed to the file.
+ * @return True if successful, false if the object is invalid or writing to the file failed.
+ */
+inline bool fileFromObject(Object* object, const File& file, FileCompression compression = FileCompression::None) noexcept {
+	if(object == nullptr){
+		return false;
+	}
+
+	FileInArchive archive(file, compression);
+	archive << object->getStaticClass()->getID();
+
+	object->serialize(archive);
+
+	archive.finish();
+
+	return !archive.failed();
+}
+
+/**
+ * @brief Serializes the given object together with its children and all objects referenced through serializeReference().
+ * Each object is stored once, no matter how many times it is referenced.
+ * @param object The root object being serialized.
+ * @param data Data buffer being set.
+ */
+inline void byteArrayFromObjectGraph(Object* object, std::vector<uint8_t>& data) noexcept {
+	if(object == nullptr){
+		return;
+	}
+
+	GraphInArchive archive;
+	archive.writeObject(object);
+
+	archive.takeByteArray(data);
+}
+
+/**
+ * @brief De-serializes an object graph written by byteArrayFromObjectGraph(), recreating the root object, its children and referenced objects.
+ * As with any other object, the recreated objects are only kept alive by strong references, such as ones restored through serializeReference().
+ * @tparam T Type of the root object.
+ * @param data Byte array containing the object graph.
+ * @param owner Owner being set to the root object.
+ * @return Strong object pointer to the root object, nullptr if the data did not describe a valid object graph.
+ */
+template<typename T, typename = std::enable_if<std::derived_from<T, Object>, T>::type>
+inline StrongObjectPtr<T> objectGraphFromByteArray(std::span<const uint8_t> data, Object* owner = nullptr) noexcept {
+	GraphOutArchive archive(data);
+	return archive.readObject<T>(owner);
 }
 
-#endif //CMF_OBJECTMEMORY_H
\ No newline at end of file
+#endif //CMF_OBJECTMEMORY_H
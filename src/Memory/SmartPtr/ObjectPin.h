@@ -0,0 +1,66 @@
+#ifndef CMF_OBJECTPIN_H
+#define CMF_OBJECTPIN_H
+
+#include "Memory/Cast.h"
+#include "Memory/ObjectManager.h"
+
+/**
+ * @brief Object pin holds a strong reference to an object for as long as it exists, taken from an object pointer under the lock of the object manager.
+ * Unlike a strong object pointer it registers no pointer location, so taking one does not allocate. Meant for keeping an object referenced through
+ * a weak pointer alive for the duration of a function, while another thread might be releasing it.
+ * @tparam T The type of object being pinned.
+ */
+template<typename T>
+class ObjectPin {
+public:
+	/**
+	 * @brief Constructor which pins the object the given object pointer points to, if it is valid.
+	 * @param object Pointer to the registered object pointer being read.
+	 */
+	inline explicit ObjectPin(Object* const* object) noexcept : object(ObjectManager::get()->acquireReference(object)) {}
+
+	/**
+	 * @brief Deleted copy constructor, since each pin holds its own reference.
+	 */
+	ObjectPin(const ObjectPin&) = delete;
+
+	/**
+	 * @brief Deleted copy assignment.
+	 */
+	ObjectPin& operator = (const ObjectPin&) = delete;
+
+	/**
+	 * @brief Destructor which gives back the reference.
+	 */
+	inline ~ObjectPin() noexcept {
+		if(object != nullptr){
+			ObjectManager::get()->releaseReference(object);
+		}
+	}
+
+	/**
+	 * @return The pinned object, nullptr if the object was not valid when pinned.
+	 */
+	inline T* get() const noexcept {
+		return cast<T>(object);
+	}
+
+	/**
+	 * @return The pinned object.
+	 */
+	inline T* operator -> () const noexcept {
+		return get();
+	}
+
+	/**
+	 * @return True if an object is pinned.
+	 */
+	inline explicit operator bool() const noexcept {
+		return object != nullptr;
+	}
+
+private:
+	Object* object = nullptr;
+};
+
+#endif //CMF_OBJECTPIN_H
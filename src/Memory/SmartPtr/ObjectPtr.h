@@ -4,6 +4,7 @@
 #include <type_traits>
 #include "Memory/Cast.h"
 #include "Memory/ObjectManager.h"
+#include "ObjectPin.h"
 
 /**
  * @brief Base object pointer class used for common functionality between the weak object pointer and the strong object pointer.
@@ -32,6 +33,10 @@ public:
 	 * @param other The object pointer being moved.
 	 */
 	inline constexpr ObjectPtr(ObjectPtr&& other) noexcept {
+		if(other.ptr != nullptr && ObjectManager::get()->moveReference(&other.ptr, &ptr)){
+			return;
+		}
+
 		ptr = *other;
 		ObjectManager::get()->registerReference(&ptr, (*this)());
 		other = nullptr;
@@ -155,6 +160,10 @@ public:
 			ObjectManager::get()->unregisterReference(&ptr, (*this)());
 		}
 
+		if(other.ptr != nullptr && ObjectManager::get()->moveReference(&other.ptr, &ptr)){
+			return *this;
+		}
+
 		ptr = *other;
 		ObjectManager::get()->registerReference(&ptr, (*this)());
 
@@ -397,6 +406,14 @@ public:
 		return cast<T>(ptr);
 	}
 
+	/**
+	 * @return A pin keeping the object alive until it is destroyed, which is empty if the object is not valid.
+	 * Unlike get(), the pointer is read under the lock of the object manager, so it is safe while another thread is deleting the object.
+	 */
+	inline ObjectPin<T> pin() const noexcept {
+		return ObjectPin<T>(&ptr);
+	}
+
 	/**
 	 * @return True if object is valid, meaning not nullptr and valid in the object manager.
 	 */
@@ -2,10 +2,10 @@
 #define CMF_CLASS_H
 
 #include <cinttypes>
-#include <map>
 #include <string>
 #include <tuple>
 #include "Memory/SmartPtr/StrongObjectPtr.h"
+#include "Containers/FlatMap.h"
 
 class Object;
 class Class;
@@ -34,7 +34,7 @@ public:
 	void registerClass(const Class* cls) noexcept;
 
 private:
-	std::map<uint64_t, const Class*> classes;
+	FlatMap<uint64_t, const Class*> classes;
 };
 
 /**
@@ -7,12 +7,15 @@
 #include "Core/Application.h"
 #include "Class.h"
 
+// Number of ready event handles popped from the queue at once
+static constexpr size_t EventScanBatchSize = 8;
+
 const Object::ClassType Object::objectStaticClass = Object::ClassType(static_cast<uint64_t>(STRING_HASH("Object")) << 32);
 
-Object::Object() noexcept : id(ObjectIndex++){}
+Object::Object() noexcept : id(ObjectIndex++), readyEventHandles(CONFIG_CMF_EVENT_STARVATION_LIMIT){}
 
 Object::~Object() noexcept {
-	const std::set<WeakObjectPtr<Object>> children = childrenObjects;
+	const auto children = childrenObjects;
 
 	for(const WeakObjectPtr<Object>& child : children){
 		if(!isValid(child)){
@@ -98,7 +101,9 @@ void Object::onChildRemoved(Object* child) noexcept{}
 void Object::forEachChild(const std::function<bool(Object*)>& function) noexcept{
 	std::lock_guard lock(accessMutex);
 
-	for(const WeakObjectPtr<Object>& child : childrenObjects){
+	// Indexed, since callbacks may add children, which can move the list
+	for(size_t i = 0; i < childrenObjects.size(); ++i){
+		const WeakObjectPtr<Object> child = childrenObjects[i];
 		if(!child.isValid()){
 			continue;
 		}
@@ -130,20 +135,59 @@ void Object::onInstigatorChanged(Object* oldInstigator) noexcept{}
 void Object::scanEvents(TickType_t wait) noexcept{
 	const uint64_t begin = millis();
 
+	eventScanningTask.store(xTaskGetCurrentTaskHandle(), std::memory_order_relaxed);
+
 	auto eventWaitTime = std::max(static_cast<int64_t>(0), static_cast<int64_t>(wait) - (static_cast<int64_t>(millis()) - static_cast<int64_t>(begin)));
-	for(EventHandleBase* handle = nullptr; readyEventHandles.pop(handle,eventWaitTime ); ){
-		if(handle == nullptr){
-			continue;
+
+	EventHandleBase* batch[EventScanBatchSize];
+	while(readyEventHandles.waitForElement(eventWaitTime)){
+		size_t count = 0;
+		{
+			// Popped and published together, so a handle being unregistered is always found either in the queue or in the batch
+			std::lock_guard guard(accessMutex);
+			count = readyEventHandles.popN(batch, 0);
+			scanningEventHandles = std::span(batch, count);
+		}
+
+		if(count == 0){
+			break;
+		}
+
+		for(size_t i = 0; i < count; ++i){
+			EventHandleBase* handle = nullptr;
+			{
+				// Handles unregistered by callbacks of the earlier handles in the batch, or by other tasks, are cleared by unregisterEventHandle
+				std::lock_guard guard(accessMutex);
+				handle = batch[i];
+
+				// Handles unbound while being scanned are freed only once the scan is done
+				if(handle != nullptr){
+					handle->retain();
+				}
+			}
+
+			if(handle == nullptr){
+				continue;
+			}
+
+			handle->scan(0);
+			handle->release();
+		}
+
+		{
+			std::lock_guard guard(accessMutex);
+			scanningEventHandles = {};
 		}
 
-		handle->scan(0);
 		eventWaitTime = 0;
 	}
 
 	std::lock_guard guard(accessMutex);
 
 	// WARNING: This will not work, or will create an infinite loop if owner system is abused, this is intentional, events are dependent on their owner to scan events, outermost owner must be an async entity for this to work
-	for(const WeakObjectPtr<Object>& child : childrenObjects){
+	// Indexed, since callbacks may add children, which can move the list
+	for(size_t i = 0; i < childrenObjects.size(); ++i){
+		const WeakObjectPtr<Object> child = childrenObjects[i];
 		if(!child.isValid()){
 			continue;
 		}
@@ -192,10 +236,17 @@ void Object::unregisterEventHandle(EventHandleBase* handle) noexcept{
 	}
 
 	readyEventHandles.remove(handle);
+
+	std::lock_guard guard(accessMutex);
+	std::replace(scanningEventHandles.begin(), scanningEventHandles.end(), handle, (EventHandleBase*) nullptr);
 }
 
 void Object::readyEventHandle(EventHandleBase *handle) noexcept{
-	readyEventHandles.push(handle);
+	if(handle == nullptr){
+		return;
+	}
+
+	readyEventHandles.push(handle, static_cast<size_t>(handle->getPriority()));
 }
 
 Archive& Object::serialize(Archive& archive) noexcept{
@@ -239,7 +290,11 @@ inline void Object::registerChild(Object* child) noexcept{
 		return;
 	}
 
-	childrenObjects.insert(newChild);
+	if(findChild(child) != childrenObjects.end()){
+		return;
+	}
+
+	childrenObjects.push_back(newChild);
 	onChildAdded(child);
 }
 
@@ -249,9 +304,12 @@ inline void Object::removeChild(Object* child) noexcept{
 		return;
 	}
 
-	if(childrenObjects.erase(child) == 0){
+	const auto it = findChild(child);
+	if(it == childrenObjects.end()){
 		return;
 	}
 
+	childrenObjects.eraseUnordered(it);
+
 	onChildRemoved(child);
 }
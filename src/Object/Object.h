@@ -2,16 +2,22 @@
 #define CMF_OBJECT_H
 
 #include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <algorithm>
 #include <concepts>
 #include <type_traits>
 #include <mutex>
 #include <freertos/portmacro.h>
 #include <atomic>
+#include <span>
 #include "Misc/Djb.h"
 #include "Misc/TemplateTypes.h"
 #include "Memory/SmartPtr/WeakObjectPtr.h"
 #include "Memory/SmartPtr/StrongObjectPtr.h"
 #include "Containers/Queue.h"
+#include "Containers/IntrusiveQueue.h"
+#include "Containers/SmallVector.h"
+#include "Event/EventPriority.h"
 #include "Containers/Archive.h"
 #include "ObjectConstruct.h"
 #include "Class.h"
@@ -181,10 +187,18 @@ public:
 	void unregisterEventHandle(EventHandleBase* handle) noexcept;
 
 	/**
-	 * @brief Sets an event handle which is ready for callback execution
+	 * @brief Sets an event handle which is ready for callback execution. Handles which are already waiting for execution are not queued again.
+	 * Ready handles are scanned in order of their priority.
 	 */
 	void readyEventHandle(EventHandleBase* handle) noexcept;
 
+	/**
+	 * @return True if the calling task is the one which last scanned the events of this object, which is the thread of its outermost async entity.
+	 */
+	inline bool isEventScanningTask() const noexcept {
+		return eventScanningTask.load(std::memory_order_relaxed) == xTaskGetCurrentTaskHandle();
+	}
+
 	/**
 	 * @brief Serializes the object to the archive / deserializes the object from the archive.
 	 * @param archive The archive containing the data of the object before serialization / after deserialization.
@@ -230,10 +244,12 @@ private:
 	const uint32_t id;
 
 	WeakObjectPtr<Object> owner;
-	std::set<WeakObjectPtr<Object>> childrenObjects;
+	SmallVector<WeakObjectPtr<Object>, 4> childrenObjects; // Most objects own only a few children, which are then held without heap allocation
 	WeakObjectPtr<Object> instigator;
 
-	Queue<EventHandleBase*> readyEventHandles;
+	IntrusiveQueue<class EventHandleBase, EventPriorityCount> readyEventHandles; // Each handle is queued at most once in the lane of its priority, and can be removed in O(1)
+	std::span<EventHandleBase*> scanningEventHandles; // Batch of ready handles popped by scanEvents and not yet scanned
+	std::atomic<TaskHandle_t> eventScanningTask = nullptr; // Task which last called scanEvents, used to dispatch events broadcast from it directly
 
 	std::recursive_mutex accessMutex;
 
@@ -249,6 +265,17 @@ private:
 	 * @param child The child being removed.
 	 */
 	void removeChild(Object* child) noexcept;
+
+	/**
+	 * @brief Finds a child by its address, which also works while the child is being destroyed. accessMutex must be locked before calling this function.
+	 * @param child The child being searched for.
+	 * @return Iterator to the child, or the end of the children list if it is not registered.
+	 */
+	inline WeakObjectPtr<Object>* findChild(const Object* child) noexcept{
+		return std::find_if(childrenObjects.begin(), childrenObjects.end(), [child](const WeakObjectPtr<Object>& element){
+			return element.get() == child;
+		});
+	}
 };
 
 /**
@@ -5,6 +5,7 @@
 #include "Drivers/Interface/InputDriver.h"
 #include "Entity/AsyncEntity.h"
 #include "Event/EventBroadcaster.h"
+#include "Containers/FlatMap.h"
 
 class ButtonInput : public AsyncEntity {
 	GENERATED_BODY(ButtonInput, AsyncEntity, CONSTRUCTOR_PACK(const std::vector<std::pair<Enum<int>, InputPin>>&))
@@ -34,10 +35,10 @@ private:
 
 	std::set<StrongObjectPtr<InputDriver>> inputSources;
 
-	std::map<int, InputPin> buttons;
+	FlatMap<int, InputPin> buttons;
 
-	std::unordered_map<int, bool> btnState;
-	std::unordered_map<int, uint64_t> dbTime;
+	FlatMap<int, bool> btnState;
+	FlatMap<int, uint64_t> dbTime;
 
 	std::mutex accessMutex;
 
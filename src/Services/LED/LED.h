@@ -10,6 +10,7 @@
 #include "Memory/ObjectMemory.h"
 #include "Object/SubclassOf.h"
 #include "Util/stdafx.h"
+#include "Containers/FlatMap.h"
 #include <memory>
 
 DEFINE_LOG(LED)
@@ -285,7 +286,7 @@ public:
 
 		for(auto it = currentFunctions.begin(); it != currentFunctions.end();){
 			RegisteredFunction& func = it->second;
-			const LED& led = it->first;
+			const LED led = it->first; // Copied, since erasing moves the following elements into its place
 
 			if(!func.function->isDone()){
 				const DataT level = func.function->getValue();
@@ -382,11 +383,11 @@ private:
 		uint64_t lastActivation = 0;
 	};
 
-	std::map<LED, std::array<OutputPin, sizeof(DataT) / sizeof(float)>> outputs;
-	std::map<LED, RegisteredFunction> currentFunctions;
-	std::map<LED, RegisteredFunction> prevFunctions;
-	std::map<LED, DataT> prevStates;
-	std::map<LED, SemaphoreHandle_t> waitSemaphores;
+	FlatMap<LED, std::array<OutputPin, sizeof(DataT) / sizeof(float)>> outputs;
+	FlatMap<LED, RegisteredFunction> currentFunctions;
+	FlatMap<LED, RegisteredFunction> prevFunctions;
+	FlatMap<LED, DataT> prevStates;
+	FlatMap<LED, SemaphoreHandle_t> waitSemaphores;
 
 	std::mutex accessMutex;
 };
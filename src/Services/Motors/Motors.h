@@ -4,6 +4,7 @@
 #include "Entity/AsyncEntity.h"
 #include "Drivers/Interface/OutputDriver.h"
 #include "Drivers/Output/OutputPWM.h"
+#include "Containers/FlatMap.h"
 #include <cmath>
 
 template<typename Motor>
@@ -114,14 +115,14 @@ private:
 	 * Map of current motor values.
 	 * key = Motor[enum, int] , value = state[float]
 	 */
-	std::map<int, float> currentValues;
+	FlatMap<int, float> currentValues;
 
 	struct MotorPins {
 		OutputPin digitalPin;
 		OutputPin analogPin;
 	};
 
-	std::map<int, MotorPins> motorPins;
+	FlatMap<int, MotorPins> motorPins;
 
 	std::mutex accessMutex;
 };
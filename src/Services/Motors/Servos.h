@@ -5,6 +5,7 @@
 #include "Entity/AsyncEntity.h"
 #include "Drivers/Output/OutputMCPWM.h"
 #include "Drivers/Output/OutputPWM.h"
+#include "Containers/FlatMap.h"
 
 DEFINE_LOG(Servos)
 
@@ -121,11 +122,11 @@ private:
 	 * Map of current motor values.
 	 * key = Motor[enum, int] , value = state[float]
 	 */
-	std::map<Servo, float> currentValues;
+	FlatMap<Servo, float> currentValues;
 
-	std::map<Servo, OutputPin> pins;
+	FlatMap<Servo, OutputPin> pins;
 
-	std::map<Servo, std::pair<float, float>> allowedRanges;
+	FlatMap<Servo, std::pair<float, float>> allowedRanges;
 
 	/**
 	 * Map value from 0 - 1 to servo's configured allowed range.